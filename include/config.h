@@ -3,14 +3,21 @@
 // LIGHT_SLEEP - uncomment to enable light sleep by usign the RTC alarm to wake up the uC
 // #define LIGHT_SLEEP
 
+// DEEP_SLEEP - uncomment to deep sleep between display updates, the clock state is kept in RTC memory
+// Needs a reset source: the DS3231 INT pin to RST through an edge circuit (e.g. 100nF series capacitor) and/or GPIO16 to RST.
+// The buttons only work while the clock is awake, e.g. after a power cycle.
+// #define DEEP_SLEEP
+
 // RTC selection - uncomment the one you're using, comment all others and make sure pin assignemts for
 // DS1302 are correct in the parameters section further down!
 // #define RTC_DS1302
 // #define RTC_DS1307
 #define RTC_DS3231
 
-// FADING - uncomment to enable fading effects for dots/digits, other parameters further down below
+// FADING - uncomment to enable cross-fading of words that change, duration and frame time in ms
 #define FADING
+#define FADE_DURATION 800
+#define FADE_FRAME_TIME 20
 
 // autoBrightness - uncomment to enable automatic brightness adjustments by using a photoresistor/LDR
 //#define AUTOBRIGHTNESS
@@ -18,6 +25,47 @@
 // nightMode - uncomment to enable time based palette change to a dark red
 #define NIGHTMODE
 
+// default location for the automatic night mode, in 1/100 degree (north and east positive)
+#define DEFAULT_LATITUDE 4821
+#define DEFAULT_LONGITUDE 1637
+
+// SOLAR_TABLE - uncomment to keep sunrise/sunset of the default location as a per-day table in flash (~1.5 kB)
+// #define SOLAR_TABLE
+
+// SETTINGS_SAVE_DELAY - quiet period in ms after the last change before settings are written to flash
+#define SETTINGS_SAVE_DELAY 3000
+
+// PROFILER - uncomment to time the phases of each wake cycle, see Profiler.h
+// #define PROFILER
+
+// RENDER_IN_IRAM - uncomment to run the per-frame coloring and frame hash from IRAM instead of through the flash cache, costs ~1 kB of IRAM
+// #define RENDER_IN_IRAM
+
+// PALETTE_LUT_WORDS - uncomment to keep the palette colors as aligned 32 bit words, one word load per pixel instead of three
+// byte loads and usable from memory that only allows 32 bit access (IRAM), 1 kB instead of 768 bytes of RAM
+// #define PALETTE_LUT_WORDS
+
+// LOG_LEVEL_* - compile time log level per module, 0 (none) to 5 (verbose), capped by CONFIG_ARDUHAL_LOG_DEFAULT_LEVEL
+// calls above the level of their module are not built into the firmware, the runtime level in the settings filters what is left
+#ifndef LOG_LEVEL_MAIN
+#define LOG_LEVEL_MAIN 5
+#endif
+#ifndef LOG_LEVEL_CLOCK
+#define LOG_LEVEL_CLOCK 5
+#endif
+#ifndef LOG_LEVEL_SETTINGS
+#define LOG_LEVEL_SETTINGS 5
+#endif
+#ifndef LOG_LEVEL_RADIO
+#define LOG_LEVEL_RADIO 5
+#endif
+#ifndef LOG_LEVEL_WEB
+#define LOG_LEVEL_WEB 5
+#endif
+#ifndef LOG_LEVEL_BUTTONS
+#define LOG_LEVEL_BUTTONS 5
+#endif
+
 // FastForward will speed up things and advance time, this is only for testing purposes!
 // Disables AUTODST, USENTP and USERTC.
 // #define FASTFORWARD
@@ -1,1466 +1,1512 @@
+#pragma once
 /*
- * autogenerated code by timezones.py
+ * autogenerated code by timezone.py
  */
 
 #include <Arduino.h>
+#include <string_view>
 
+// the tables are inline, the firmware holds one copy no matter how many files include this header
 namespace data {
 
-// timezone names
-constexpr const char Africa_Abidjan[] PROGMEM = "Africa/Abidjan";
-constexpr const char Africa_Accra[] PROGMEM = "Africa/Accra";
-constexpr const char Africa_Addis_Ababa[] PROGMEM = "Africa/Addis_Ababa";
-constexpr const char Africa_Algiers[] PROGMEM = "Africa/Algiers";
-constexpr const char Africa_Asmara[] PROGMEM = "Africa/Asmara";
-constexpr const char Africa_Bamako[] PROGMEM = "Africa/Bamako";
-constexpr const char Africa_Bangui[] PROGMEM = "Africa/Bangui";
-constexpr const char Africa_Banjul[] PROGMEM = "Africa/Banjul";
-constexpr const char Africa_Bissau[] PROGMEM = "Africa/Bissau";
-constexpr const char Africa_Blantyre[] PROGMEM = "Africa/Blantyre";
-constexpr const char Africa_Brazzaville[] PROGMEM = "Africa/Brazzaville";
-constexpr const char Africa_Bujumbura[] PROGMEM = "Africa/Bujumbura";
-constexpr const char Africa_Cairo[] PROGMEM = "Africa/Cairo";
-constexpr const char Africa_Casablanca[] PROGMEM = "Africa/Casablanca";
-constexpr const char Africa_Ceuta[] PROGMEM = "Africa/Ceuta";
-constexpr const char Africa_Conakry[] PROGMEM = "Africa/Conakry";
-constexpr const char Africa_Dakar[] PROGMEM = "Africa/Dakar";
-constexpr const char Africa_Dar_es_Salaam[] PROGMEM = "Africa/Dar_es_Salaam";
-constexpr const char Africa_Djibouti[] PROGMEM = "Africa/Djibouti";
-constexpr const char Africa_Douala[] PROGMEM = "Africa/Douala";
-constexpr const char Africa_El_Aaiun[] PROGMEM = "Africa/El_Aaiun";
-constexpr const char Africa_Freetown[] PROGMEM = "Africa/Freetown";
-constexpr const char Africa_Gaborone[] PROGMEM = "Africa/Gaborone";
-constexpr const char Africa_Harare[] PROGMEM = "Africa/Harare";
-constexpr const char Africa_Johannesburg[] PROGMEM = "Africa/Johannesburg";
-constexpr const char Africa_Juba[] PROGMEM = "Africa/Juba";
-constexpr const char Africa_Kampala[] PROGMEM = "Africa/Kampala";
-constexpr const char Africa_Khartoum[] PROGMEM = "Africa/Khartoum";
-constexpr const char Africa_Kigali[] PROGMEM = "Africa/Kigali";
-constexpr const char Africa_Kinshasa[] PROGMEM = "Africa/Kinshasa";
-constexpr const char Africa_Lagos[] PROGMEM = "Africa/Lagos";
-constexpr const char Africa_Libreville[] PROGMEM = "Africa/Libreville";
-constexpr const char Africa_Lome[] PROGMEM = "Africa/Lome";
-constexpr const char Africa_Luanda[] PROGMEM = "Africa/Luanda";
-constexpr const char Africa_Lubumbashi[] PROGMEM = "Africa/Lubumbashi";
-constexpr const char Africa_Lusaka[] PROGMEM = "Africa/Lusaka";
-constexpr const char Africa_Malabo[] PROGMEM = "Africa/Malabo";
-constexpr const char Africa_Maputo[] PROGMEM = "Africa/Maputo";
-constexpr const char Africa_Maseru[] PROGMEM = "Africa/Maseru";
-constexpr const char Africa_Mbabane[] PROGMEM = "Africa/Mbabane";
-constexpr const char Africa_Mogadishu[] PROGMEM = "Africa/Mogadishu";
-constexpr const char Africa_Monrovia[] PROGMEM = "Africa/Monrovia";
-constexpr const char Africa_Nairobi[] PROGMEM = "Africa/Nairobi";
-constexpr const char Africa_Ndjamena[] PROGMEM = "Africa/Ndjamena";
-constexpr const char Africa_Niamey[] PROGMEM = "Africa/Niamey";
-constexpr const char Africa_Nouakchott[] PROGMEM = "Africa/Nouakchott";
-constexpr const char Africa_Ouagadougou[] PROGMEM = "Africa/Ouagadougou";
-constexpr const char Africa_Porto_Novo[] PROGMEM = "Africa/Porto-Novo";
-constexpr const char Africa_Sao_Tome[] PROGMEM = "Africa/Sao_Tome";
-constexpr const char Africa_Tripoli[] PROGMEM = "Africa/Tripoli";
-constexpr const char Africa_Tunis[] PROGMEM = "Africa/Tunis";
-constexpr const char Africa_Windhoek[] PROGMEM = "Africa/Windhoek";
-constexpr const char America_Adak[] PROGMEM = "America/Adak";
-constexpr const char America_Anchorage[] PROGMEM = "America/Anchorage";
-constexpr const char America_Anguilla[] PROGMEM = "America/Anguilla";
-constexpr const char America_Antigua[] PROGMEM = "America/Antigua";
-constexpr const char America_Araguaina[] PROGMEM = "America/Araguaina";
-constexpr const char America_Argentina_Buenos_Aires[] PROGMEM = "America/Argentina/Buenos_Aires";
-constexpr const char America_Argentina_Catamarca[] PROGMEM = "America/Argentina/Catamarca";
-constexpr const char America_Argentina_Cordoba[] PROGMEM = "America/Argentina/Cordoba";
-constexpr const char America_Argentina_Jujuy[] PROGMEM = "America/Argentina/Jujuy";
-constexpr const char America_Argentina_La_Rioja[] PROGMEM = "America/Argentina/La_Rioja";
-constexpr const char America_Argentina_Mendoza[] PROGMEM = "America/Argentina/Mendoza";
-constexpr const char America_Argentina_Rio_Gallegos[] PROGMEM = "America/Argentina/Rio_Gallegos";
-constexpr const char America_Argentina_Salta[] PROGMEM = "America/Argentina/Salta";
-constexpr const char America_Argentina_San_Juan[] PROGMEM = "America/Argentina/San_Juan";
-constexpr const char America_Argentina_San_Luis[] PROGMEM = "America/Argentina/San_Luis";
-constexpr const char America_Argentina_Tucuman[] PROGMEM = "America/Argentina/Tucuman";
-constexpr const char America_Argentina_Ushuaia[] PROGMEM = "America/Argentina/Ushuaia";
-constexpr const char America_Aruba[] PROGMEM = "America/Aruba";
-constexpr const char America_Asuncion[] PROGMEM = "America/Asuncion";
-constexpr const char America_Atikokan[] PROGMEM = "America/Atikokan";
-constexpr const char America_Bahia[] PROGMEM = "America/Bahia";
-constexpr const char America_Bahia_Banderas[] PROGMEM = "America/Bahia_Banderas";
-constexpr const char America_Barbados[] PROGMEM = "America/Barbados";
-constexpr const char America_Belem[] PROGMEM = "America/Belem";
-constexpr const char America_Belize[] PROGMEM = "America/Belize";
-constexpr const char America_Blanc_Sablon[] PROGMEM = "America/Blanc-Sablon";
-constexpr const char America_Boa_Vista[] PROGMEM = "America/Boa_Vista";
-constexpr const char America_Bogota[] PROGMEM = "America/Bogota";
-constexpr const char America_Boise[] PROGMEM = "America/Boise";
-constexpr const char America_Cambridge_Bay[] PROGMEM = "America/Cambridge_Bay";
-constexpr const char America_Campo_Grande[] PROGMEM = "America/Campo_Grande";
-constexpr const char America_Cancun[] PROGMEM = "America/Cancun";
-constexpr const char America_Caracas[] PROGMEM = "America/Caracas";
-constexpr const char America_Cayenne[] PROGMEM = "America/Cayenne";
-constexpr const char America_Cayman[] PROGMEM = "America/Cayman";
-constexpr const char America_Chicago[] PROGMEM = "America/Chicago";
-constexpr const char America_Chihuahua[] PROGMEM = "America/Chihuahua";
-constexpr const char America_Costa_Rica[] PROGMEM = "America/Costa_Rica";
-constexpr const char America_Creston[] PROGMEM = "America/Creston";
-constexpr const char America_Cuiaba[] PROGMEM = "America/Cuiaba";
-constexpr const char America_Curacao[] PROGMEM = "America/Curacao";
-constexpr const char America_Danmarkshavn[] PROGMEM = "America/Danmarkshavn";
-constexpr const char America_Dawson[] PROGMEM = "America/Dawson";
-constexpr const char America_Dawson_Creek[] PROGMEM = "America/Dawson_Creek";
-constexpr const char America_Denver[] PROGMEM = "America/Denver";
-constexpr const char America_Detroit[] PROGMEM = "America/Detroit";
-constexpr const char America_Dominica[] PROGMEM = "America/Dominica";
-constexpr const char America_Edmonton[] PROGMEM = "America/Edmonton";
-constexpr const char America_Eirunepe[] PROGMEM = "America/Eirunepe";
-constexpr const char America_El_Salvador[] PROGMEM = "America/El_Salvador";
-constexpr const char America_Fortaleza[] PROGMEM = "America/Fortaleza";
-constexpr const char America_Fort_Nelson[] PROGMEM = "America/Fort_Nelson";
-constexpr const char America_Glace_Bay[] PROGMEM = "America/Glace_Bay";
-constexpr const char America_Godthab[] PROGMEM = "America/Godthab";
-constexpr const char America_Goose_Bay[] PROGMEM = "America/Goose_Bay";
-constexpr const char America_Grand_Turk[] PROGMEM = "America/Grand_Turk";
-constexpr const char America_Grenada[] PROGMEM = "America/Grenada";
-constexpr const char America_Guadeloupe[] PROGMEM = "America/Guadeloupe";
-constexpr const char America_Guatemala[] PROGMEM = "America/Guatemala";
-constexpr const char America_Guayaquil[] PROGMEM = "America/Guayaquil";
-constexpr const char America_Guyana[] PROGMEM = "America/Guyana";
-constexpr const char America_Halifax[] PROGMEM = "America/Halifax";
-constexpr const char America_Havana[] PROGMEM = "America/Havana";
-constexpr const char America_Hermosillo[] PROGMEM = "America/Hermosillo";
-constexpr const char America_Indiana_Indianapolis[] PROGMEM = "America/Indiana/Indianapolis";
-constexpr const char America_Indiana_Knox[] PROGMEM = "America/Indiana/Knox";
-constexpr const char America_Indiana_Marengo[] PROGMEM = "America/Indiana/Marengo";
-constexpr const char America_Indiana_Petersburg[] PROGMEM = "America/Indiana/Petersburg";
-constexpr const char America_Indiana_Tell_City[] PROGMEM = "America/Indiana/Tell_City";
-constexpr const char America_Indiana_Vevay[] PROGMEM = "America/Indiana/Vevay";
-constexpr const char America_Indiana_Vincennes[] PROGMEM = "America/Indiana/Vincennes";
-constexpr const char America_Indiana_Winamac[] PROGMEM = "America/Indiana/Winamac";
-constexpr const char America_Inuvik[] PROGMEM = "America/Inuvik";
-constexpr const char America_Iqaluit[] PROGMEM = "America/Iqaluit";
-constexpr const char America_Jamaica[] PROGMEM = "America/Jamaica";
-constexpr const char America_Juneau[] PROGMEM = "America/Juneau";
-constexpr const char America_Kentucky_Louisville[] PROGMEM = "America/Kentucky/Louisville";
-constexpr const char America_Kentucky_Monticello[] PROGMEM = "America/Kentucky/Monticello";
-constexpr const char America_Kralendijk[] PROGMEM = "America/Kralendijk";
-constexpr const char America_La_Paz[] PROGMEM = "America/La_Paz";
-constexpr const char America_Lima[] PROGMEM = "America/Lima";
-constexpr const char America_Los_Angeles[] PROGMEM = "America/Los_Angeles";
-constexpr const char America_Lower_Princes[] PROGMEM = "America/Lower_Princes";
-constexpr const char America_Maceio[] PROGMEM = "America/Maceio";
-constexpr const char America_Managua[] PROGMEM = "America/Managua";
-constexpr const char America_Manaus[] PROGMEM = "America/Manaus";
-constexpr const char America_Marigot[] PROGMEM = "America/Marigot";
-constexpr const char America_Martinique[] PROGMEM = "America/Martinique";
-constexpr const char America_Matamoros[] PROGMEM = "America/Matamoros";
-constexpr const char America_Mazatlan[] PROGMEM = "America/Mazatlan";
-constexpr const char America_Menominee[] PROGMEM = "America/Menominee";
-constexpr const char America_Merida[] PROGMEM = "America/Merida";
-constexpr const char America_Metlakatla[] PROGMEM = "America/Metlakatla";
-constexpr const char America_Mexico_City[] PROGMEM = "America/Mexico_City";
-constexpr const char America_Miquelon[] PROGMEM = "America/Miquelon";
-constexpr const char America_Moncton[] PROGMEM = "America/Moncton";
-constexpr const char America_Monterrey[] PROGMEM = "America/Monterrey";
-constexpr const char America_Montevideo[] PROGMEM = "America/Montevideo";
-constexpr const char America_Montreal[] PROGMEM = "America/Montreal";
-constexpr const char America_Montserrat[] PROGMEM = "America/Montserrat";
-constexpr const char America_Nassau[] PROGMEM = "America/Nassau";
-constexpr const char America_New_York[] PROGMEM = "America/New_York";
-constexpr const char America_Nipigon[] PROGMEM = "America/Nipigon";
-constexpr const char America_Nome[] PROGMEM = "America/Nome";
-constexpr const char America_Noronha[] PROGMEM = "America/Noronha";
-constexpr const char America_North_Dakota_Beulah[] PROGMEM = "America/North_Dakota/Beulah";
-constexpr const char America_North_Dakota_Center[] PROGMEM = "America/North_Dakota/Center";
-constexpr const char America_North_Dakota_New_Salem[] PROGMEM = "America/North_Dakota/New_Salem";
-constexpr const char America_Nuuk[] PROGMEM = "America/Nuuk";
-constexpr const char America_Ojinaga[] PROGMEM = "America/Ojinaga";
-constexpr const char America_Panama[] PROGMEM = "America/Panama";
-constexpr const char America_Pangnirtung[] PROGMEM = "America/Pangnirtung";
-constexpr const char America_Paramaribo[] PROGMEM = "America/Paramaribo";
-constexpr const char America_Phoenix[] PROGMEM = "America/Phoenix";
-constexpr const char America_Port_au_Prince[] PROGMEM = "America/Port-au-Prince";
-constexpr const char America_Port_of_Spain[] PROGMEM = "America/Port_of_Spain";
-constexpr const char America_Porto_Velho[] PROGMEM = "America/Porto_Velho";
-constexpr const char America_Puerto_Rico[] PROGMEM = "America/Puerto_Rico";
-constexpr const char America_Punta_Arenas[] PROGMEM = "America/Punta_Arenas";
-constexpr const char America_Rainy_River[] PROGMEM = "America/Rainy_River";
-constexpr const char America_Rankin_Inlet[] PROGMEM = "America/Rankin_Inlet";
-constexpr const char America_Recife[] PROGMEM = "America/Recife";
-constexpr const char America_Regina[] PROGMEM = "America/Regina";
-constexpr const char America_Resolute[] PROGMEM = "America/Resolute";
-constexpr const char America_Rio_Branco[] PROGMEM = "America/Rio_Branco";
-constexpr const char America_Santarem[] PROGMEM = "America/Santarem";
-constexpr const char America_Santiago[] PROGMEM = "America/Santiago";
-constexpr const char America_Santo_Domingo[] PROGMEM = "America/Santo_Domingo";
-constexpr const char America_Sao_Paulo[] PROGMEM = "America/Sao_Paulo";
-constexpr const char America_Scoresbysund[] PROGMEM = "America/Scoresbysund";
-constexpr const char America_Sitka[] PROGMEM = "America/Sitka";
-constexpr const char America_St_Barthelemy[] PROGMEM = "America/St_Barthelemy";
-constexpr const char America_St_Johns[] PROGMEM = "America/St_Johns";
-constexpr const char America_St_Kitts[] PROGMEM = "America/St_Kitts";
-constexpr const char America_St_Lucia[] PROGMEM = "America/St_Lucia";
-constexpr const char America_St_Thomas[] PROGMEM = "America/St_Thomas";
-constexpr const char America_St_Vincent[] PROGMEM = "America/St_Vincent";
-constexpr const char America_Swift_Current[] PROGMEM = "America/Swift_Current";
-constexpr const char America_Tegucigalpa[] PROGMEM = "America/Tegucigalpa";
-constexpr const char America_Thule[] PROGMEM = "America/Thule";
-constexpr const char America_Thunder_Bay[] PROGMEM = "America/Thunder_Bay";
-constexpr const char America_Tijuana[] PROGMEM = "America/Tijuana";
-constexpr const char America_Toronto[] PROGMEM = "America/Toronto";
-constexpr const char America_Tortola[] PROGMEM = "America/Tortola";
-constexpr const char America_Vancouver[] PROGMEM = "America/Vancouver";
-constexpr const char America_Whitehorse[] PROGMEM = "America/Whitehorse";
-constexpr const char America_Winnipeg[] PROGMEM = "America/Winnipeg";
-constexpr const char America_Yakutat[] PROGMEM = "America/Yakutat";
-constexpr const char America_Yellowknife[] PROGMEM = "America/Yellowknife";
-constexpr const char Antarctica_Casey[] PROGMEM = "Antarctica/Casey";
-constexpr const char Antarctica_Davis[] PROGMEM = "Antarctica/Davis";
-constexpr const char Antarctica_DumontDUrville[] PROGMEM = "Antarctica/DumontDUrville";
-constexpr const char Antarctica_Macquarie[] PROGMEM = "Antarctica/Macquarie";
-constexpr const char Antarctica_Mawson[] PROGMEM = "Antarctica/Mawson";
-constexpr const char Antarctica_McMurdo[] PROGMEM = "Antarctica/McMurdo";
-constexpr const char Antarctica_Palmer[] PROGMEM = "Antarctica/Palmer";
-constexpr const char Antarctica_Rothera[] PROGMEM = "Antarctica/Rothera";
-constexpr const char Antarctica_Syowa[] PROGMEM = "Antarctica/Syowa";
-constexpr const char Antarctica_Troll[] PROGMEM = "Antarctica/Troll";
-constexpr const char Antarctica_Vostok[] PROGMEM = "Antarctica/Vostok";
-constexpr const char Arctic_Longyearbyen[] PROGMEM = "Arctic/Longyearbyen";
-constexpr const char Asia_Aden[] PROGMEM = "Asia/Aden";
-constexpr const char Asia_Almaty[] PROGMEM = "Asia/Almaty";
-constexpr const char Asia_Amman[] PROGMEM = "Asia/Amman";
-constexpr const char Asia_Anadyr[] PROGMEM = "Asia/Anadyr";
-constexpr const char Asia_Aqtau[] PROGMEM = "Asia/Aqtau";
-constexpr const char Asia_Aqtobe[] PROGMEM = "Asia/Aqtobe";
-constexpr const char Asia_Ashgabat[] PROGMEM = "Asia/Ashgabat";
-constexpr const char Asia_Atyrau[] PROGMEM = "Asia/Atyrau";
-constexpr const char Asia_Baghdad[] PROGMEM = "Asia/Baghdad";
-constexpr const char Asia_Bahrain[] PROGMEM = "Asia/Bahrain";
-constexpr const char Asia_Baku[] PROGMEM = "Asia/Baku";
-constexpr const char Asia_Bangkok[] PROGMEM = "Asia/Bangkok";
-constexpr const char Asia_Barnaul[] PROGMEM = "Asia/Barnaul";
-constexpr const char Asia_Beirut[] PROGMEM = "Asia/Beirut";
-constexpr const char Asia_Bishkek[] PROGMEM = "Asia/Bishkek";
-constexpr const char Asia_Brunei[] PROGMEM = "Asia/Brunei";
-constexpr const char Asia_Chita[] PROGMEM = "Asia/Chita";
-constexpr const char Asia_Choibalsan[] PROGMEM = "Asia/Choibalsan";
-constexpr const char Asia_Colombo[] PROGMEM = "Asia/Colombo";
-constexpr const char Asia_Damascus[] PROGMEM = "Asia/Damascus";
-constexpr const char Asia_Dhaka[] PROGMEM = "Asia/Dhaka";
-constexpr const char Asia_Dili[] PROGMEM = "Asia/Dili";
-constexpr const char Asia_Dubai[] PROGMEM = "Asia/Dubai";
-constexpr const char Asia_Dushanbe[] PROGMEM = "Asia/Dushanbe";
-constexpr const char Asia_Famagusta[] PROGMEM = "Asia/Famagusta";
-constexpr const char Asia_Gaza[] PROGMEM = "Asia/Gaza";
-constexpr const char Asia_Hebron[] PROGMEM = "Asia/Hebron";
-constexpr const char Asia_Ho_Chi_Minh[] PROGMEM = "Asia/Ho_Chi_Minh";
-constexpr const char Asia_Hong_Kong[] PROGMEM = "Asia/Hong_Kong";
-constexpr const char Asia_Hovd[] PROGMEM = "Asia/Hovd";
-constexpr const char Asia_Irkutsk[] PROGMEM = "Asia/Irkutsk";
-constexpr const char Asia_Jakarta[] PROGMEM = "Asia/Jakarta";
-constexpr const char Asia_Jayapura[] PROGMEM = "Asia/Jayapura";
-constexpr const char Asia_Jerusalem[] PROGMEM = "Asia/Jerusalem";
-constexpr const char Asia_Kabul[] PROGMEM = "Asia/Kabul";
-constexpr const char Asia_Kamchatka[] PROGMEM = "Asia/Kamchatka";
-constexpr const char Asia_Karachi[] PROGMEM = "Asia/Karachi";
-constexpr const char Asia_Kathmandu[] PROGMEM = "Asia/Kathmandu";
-constexpr const char Asia_Khandyga[] PROGMEM = "Asia/Khandyga";
-constexpr const char Asia_Kolkata[] PROGMEM = "Asia/Kolkata";
-constexpr const char Asia_Krasnoyarsk[] PROGMEM = "Asia/Krasnoyarsk";
-constexpr const char Asia_Kuala_Lumpur[] PROGMEM = "Asia/Kuala_Lumpur";
-constexpr const char Asia_Kuching[] PROGMEM = "Asia/Kuching";
-constexpr const char Asia_Kuwait[] PROGMEM = "Asia/Kuwait";
-constexpr const char Asia_Macau[] PROGMEM = "Asia/Macau";
-constexpr const char Asia_Magadan[] PROGMEM = "Asia/Magadan";
-constexpr const char Asia_Makassar[] PROGMEM = "Asia/Makassar";
-constexpr const char Asia_Manila[] PROGMEM = "Asia/Manila";
-constexpr const char Asia_Muscat[] PROGMEM = "Asia/Muscat";
-constexpr const char Asia_Nicosia[] PROGMEM = "Asia/Nicosia";
-constexpr const char Asia_Novokuznetsk[] PROGMEM = "Asia/Novokuznetsk";
-constexpr const char Asia_Novosibirsk[] PROGMEM = "Asia/Novosibirsk";
-constexpr const char Asia_Omsk[] PROGMEM = "Asia/Omsk";
-constexpr const char Asia_Oral[] PROGMEM = "Asia/Oral";
-constexpr const char Asia_Phnom_Penh[] PROGMEM = "Asia/Phnom_Penh";
-constexpr const char Asia_Pontianak[] PROGMEM = "Asia/Pontianak";
-constexpr const char Asia_Pyongyang[] PROGMEM = "Asia/Pyongyang";
-constexpr const char Asia_Qatar[] PROGMEM = "Asia/Qatar";
-constexpr const char Asia_Qyzylorda[] PROGMEM = "Asia/Qyzylorda";
-constexpr const char Asia_Riyadh[] PROGMEM = "Asia/Riyadh";
-constexpr const char Asia_Sakhalin[] PROGMEM = "Asia/Sakhalin";
-constexpr const char Asia_Samarkand[] PROGMEM = "Asia/Samarkand";
-constexpr const char Asia_Seoul[] PROGMEM = "Asia/Seoul";
-constexpr const char Asia_Shanghai[] PROGMEM = "Asia/Shanghai";
-constexpr const char Asia_Singapore[] PROGMEM = "Asia/Singapore";
-constexpr const char Asia_Srednekolymsk[] PROGMEM = "Asia/Srednekolymsk";
-constexpr const char Asia_Taipei[] PROGMEM = "Asia/Taipei";
-constexpr const char Asia_Tashkent[] PROGMEM = "Asia/Tashkent";
-constexpr const char Asia_Tbilisi[] PROGMEM = "Asia/Tbilisi";
-constexpr const char Asia_Tehran[] PROGMEM = "Asia/Tehran";
-constexpr const char Asia_Thimphu[] PROGMEM = "Asia/Thimphu";
-constexpr const char Asia_Tokyo[] PROGMEM = "Asia/Tokyo";
-constexpr const char Asia_Tomsk[] PROGMEM = "Asia/Tomsk";
-constexpr const char Asia_Ulaanbaatar[] PROGMEM = "Asia/Ulaanbaatar";
-constexpr const char Asia_Urumqi[] PROGMEM = "Asia/Urumqi";
-constexpr const char Asia_Ust_Nera[] PROGMEM = "Asia/Ust-Nera";
-constexpr const char Asia_Vientiane[] PROGMEM = "Asia/Vientiane";
-constexpr const char Asia_Vladivostok[] PROGMEM = "Asia/Vladivostok";
-constexpr const char Asia_Yakutsk[] PROGMEM = "Asia/Yakutsk";
-constexpr const char Asia_Yangon[] PROGMEM = "Asia/Yangon";
-constexpr const char Asia_Yekaterinburg[] PROGMEM = "Asia/Yekaterinburg";
-constexpr const char Asia_Yerevan[] PROGMEM = "Asia/Yerevan";
-constexpr const char Atlantic_Azores[] PROGMEM = "Atlantic/Azores";
-constexpr const char Atlantic_Bermuda[] PROGMEM = "Atlantic/Bermuda";
-constexpr const char Atlantic_Canary[] PROGMEM = "Atlantic/Canary";
-constexpr const char Atlantic_Cape_Verde[] PROGMEM = "Atlantic/Cape_Verde";
-constexpr const char Atlantic_Faroe[] PROGMEM = "Atlantic/Faroe";
-constexpr const char Atlantic_Madeira[] PROGMEM = "Atlantic/Madeira";
-constexpr const char Atlantic_Reykjavik[] PROGMEM = "Atlantic/Reykjavik";
-constexpr const char Atlantic_South_Georgia[] PROGMEM = "Atlantic/South_Georgia";
-constexpr const char Atlantic_Stanley[] PROGMEM = "Atlantic/Stanley";
-constexpr const char Atlantic_St_Helena[] PROGMEM = "Atlantic/St_Helena";
-constexpr const char Australia_Adelaide[] PROGMEM = "Australia/Adelaide";
-constexpr const char Australia_Brisbane[] PROGMEM = "Australia/Brisbane";
-constexpr const char Australia_Broken_Hill[] PROGMEM = "Australia/Broken_Hill";
-constexpr const char Australia_Currie[] PROGMEM = "Australia/Currie";
-constexpr const char Australia_Darwin[] PROGMEM = "Australia/Darwin";
-constexpr const char Australia_Eucla[] PROGMEM = "Australia/Eucla";
-constexpr const char Australia_Hobart[] PROGMEM = "Australia/Hobart";
-constexpr const char Australia_Lindeman[] PROGMEM = "Australia/Lindeman";
-constexpr const char Australia_Lord_Howe[] PROGMEM = "Australia/Lord_Howe";
-constexpr const char Australia_Melbourne[] PROGMEM = "Australia/Melbourne";
-constexpr const char Australia_Perth[] PROGMEM = "Australia/Perth";
-constexpr const char Australia_Sydney[] PROGMEM = "Australia/Sydney";
-constexpr const char Europe_Amsterdam[] PROGMEM = "Europe/Amsterdam";
-constexpr const char Europe_Andorra[] PROGMEM = "Europe/Andorra";
-constexpr const char Europe_Astrakhan[] PROGMEM = "Europe/Astrakhan";
-constexpr const char Europe_Athens[] PROGMEM = "Europe/Athens";
-constexpr const char Europe_Belgrade[] PROGMEM = "Europe/Belgrade";
-constexpr const char Europe_Berlin[] PROGMEM = "Europe/Berlin";
-constexpr const char Europe_Bratislava[] PROGMEM = "Europe/Bratislava";
-constexpr const char Europe_Brussels[] PROGMEM = "Europe/Brussels";
-constexpr const char Europe_Bucharest[] PROGMEM = "Europe/Bucharest";
-constexpr const char Europe_Budapest[] PROGMEM = "Europe/Budapest";
-constexpr const char Europe_Busingen[] PROGMEM = "Europe/Busingen";
-constexpr const char Europe_Chisinau[] PROGMEM = "Europe/Chisinau";
-constexpr const char Europe_Copenhagen[] PROGMEM = "Europe/Copenhagen";
-constexpr const char Europe_Dublin[] PROGMEM = "Europe/Dublin";
-constexpr const char Europe_Gibraltar[] PROGMEM = "Europe/Gibraltar";
-constexpr const char Europe_Guernsey[] PROGMEM = "Europe/Guernsey";
-constexpr const char Europe_Helsinki[] PROGMEM = "Europe/Helsinki";
-constexpr const char Europe_Isle_of_Man[] PROGMEM = "Europe/Isle_of_Man";
-constexpr const char Europe_Istanbul[] PROGMEM = "Europe/Istanbul";
-constexpr const char Europe_Jersey[] PROGMEM = "Europe/Jersey";
-constexpr const char Europe_Kaliningrad[] PROGMEM = "Europe/Kaliningrad";
-constexpr const char Europe_Kiev[] PROGMEM = "Europe/Kiev";
-constexpr const char Europe_Kirov[] PROGMEM = "Europe/Kirov";
-constexpr const char Europe_Lisbon[] PROGMEM = "Europe/Lisbon";
-constexpr const char Europe_Ljubljana[] PROGMEM = "Europe/Ljubljana";
-constexpr const char Europe_London[] PROGMEM = "Europe/London";
-constexpr const char Europe_Luxembourg[] PROGMEM = "Europe/Luxembourg";
-constexpr const char Europe_Madrid[] PROGMEM = "Europe/Madrid";
-constexpr const char Europe_Malta[] PROGMEM = "Europe/Malta";
-constexpr const char Europe_Mariehamn[] PROGMEM = "Europe/Mariehamn";
-constexpr const char Europe_Minsk[] PROGMEM = "Europe/Minsk";
-constexpr const char Europe_Monaco[] PROGMEM = "Europe/Monaco";
-constexpr const char Europe_Moscow[] PROGMEM = "Europe/Moscow";
-constexpr const char Europe_Oslo[] PROGMEM = "Europe/Oslo";
-constexpr const char Europe_Paris[] PROGMEM = "Europe/Paris";
-constexpr const char Europe_Podgorica[] PROGMEM = "Europe/Podgorica";
-constexpr const char Europe_Prague[] PROGMEM = "Europe/Prague";
-constexpr const char Europe_Riga[] PROGMEM = "Europe/Riga";
-constexpr const char Europe_Rome[] PROGMEM = "Europe/Rome";
-constexpr const char Europe_Samara[] PROGMEM = "Europe/Samara";
-constexpr const char Europe_San_Marino[] PROGMEM = "Europe/San_Marino";
-constexpr const char Europe_Sarajevo[] PROGMEM = "Europe/Sarajevo";
-constexpr const char Europe_Saratov[] PROGMEM = "Europe/Saratov";
-constexpr const char Europe_Simferopol[] PROGMEM = "Europe/Simferopol";
-constexpr const char Europe_Skopje[] PROGMEM = "Europe/Skopje";
-constexpr const char Europe_Sofia[] PROGMEM = "Europe/Sofia";
-constexpr const char Europe_Stockholm[] PROGMEM = "Europe/Stockholm";
-constexpr const char Europe_Tallinn[] PROGMEM = "Europe/Tallinn";
-constexpr const char Europe_Tirane[] PROGMEM = "Europe/Tirane";
-constexpr const char Europe_Ulyanovsk[] PROGMEM = "Europe/Ulyanovsk";
-constexpr const char Europe_Uzhgorod[] PROGMEM = "Europe/Uzhgorod";
-constexpr const char Europe_Vaduz[] PROGMEM = "Europe/Vaduz";
-constexpr const char Europe_Vatican[] PROGMEM = "Europe/Vatican";
-constexpr const char Europe_Vienna[] PROGMEM = "Europe/Vienna";
-constexpr const char Europe_Vilnius[] PROGMEM = "Europe/Vilnius";
-constexpr const char Europe_Volgograd[] PROGMEM = "Europe/Volgograd";
-constexpr const char Europe_Warsaw[] PROGMEM = "Europe/Warsaw";
-constexpr const char Europe_Zagreb[] PROGMEM = "Europe/Zagreb";
-constexpr const char Europe_Zaporozhye[] PROGMEM = "Europe/Zaporozhye";
-constexpr const char Europe_Zurich[] PROGMEM = "Europe/Zurich";
-constexpr const char Indian_Antananarivo[] PROGMEM = "Indian/Antananarivo";
-constexpr const char Indian_Chagos[] PROGMEM = "Indian/Chagos";
-constexpr const char Indian_Christmas[] PROGMEM = "Indian/Christmas";
-constexpr const char Indian_Cocos[] PROGMEM = "Indian/Cocos";
-constexpr const char Indian_Comoro[] PROGMEM = "Indian/Comoro";
-constexpr const char Indian_Kerguelen[] PROGMEM = "Indian/Kerguelen";
-constexpr const char Indian_Mahe[] PROGMEM = "Indian/Mahe";
-constexpr const char Indian_Maldives[] PROGMEM = "Indian/Maldives";
-constexpr const char Indian_Mauritius[] PROGMEM = "Indian/Mauritius";
-constexpr const char Indian_Mayotte[] PROGMEM = "Indian/Mayotte";
-constexpr const char Indian_Reunion[] PROGMEM = "Indian/Reunion";
-constexpr const char Pacific_Apia[] PROGMEM = "Pacific/Apia";
-constexpr const char Pacific_Auckland[] PROGMEM = "Pacific/Auckland";
-constexpr const char Pacific_Bougainville[] PROGMEM = "Pacific/Bougainville";
-constexpr const char Pacific_Chatham[] PROGMEM = "Pacific/Chatham";
-constexpr const char Pacific_Chuuk[] PROGMEM = "Pacific/Chuuk";
-constexpr const char Pacific_Easter[] PROGMEM = "Pacific/Easter";
-constexpr const char Pacific_Efate[] PROGMEM = "Pacific/Efate";
-constexpr const char Pacific_Enderbury[] PROGMEM = "Pacific/Enderbury";
-constexpr const char Pacific_Fakaofo[] PROGMEM = "Pacific/Fakaofo";
-constexpr const char Pacific_Fiji[] PROGMEM = "Pacific/Fiji";
-constexpr const char Pacific_Funafuti[] PROGMEM = "Pacific/Funafuti";
-constexpr const char Pacific_Galapagos[] PROGMEM = "Pacific/Galapagos";
-constexpr const char Pacific_Gambier[] PROGMEM = "Pacific/Gambier";
-constexpr const char Pacific_Guadalcanal[] PROGMEM = "Pacific/Guadalcanal";
-constexpr const char Pacific_Guam[] PROGMEM = "Pacific/Guam";
-constexpr const char Pacific_Honolulu[] PROGMEM = "Pacific/Honolulu";
-constexpr const char Pacific_Kiritimati[] PROGMEM = "Pacific/Kiritimati";
-constexpr const char Pacific_Kosrae[] PROGMEM = "Pacific/Kosrae";
-constexpr const char Pacific_Kwajalein[] PROGMEM = "Pacific/Kwajalein";
-constexpr const char Pacific_Majuro[] PROGMEM = "Pacific/Majuro";
-constexpr const char Pacific_Marquesas[] PROGMEM = "Pacific/Marquesas";
-constexpr const char Pacific_Midway[] PROGMEM = "Pacific/Midway";
-constexpr const char Pacific_Nauru[] PROGMEM = "Pacific/Nauru";
-constexpr const char Pacific_Niue[] PROGMEM = "Pacific/Niue";
-constexpr const char Pacific_Norfolk[] PROGMEM = "Pacific/Norfolk";
-constexpr const char Pacific_Noumea[] PROGMEM = "Pacific/Noumea";
-constexpr const char Pacific_Pago_Pago[] PROGMEM = "Pacific/Pago_Pago";
-constexpr const char Pacific_Palau[] PROGMEM = "Pacific/Palau";
-constexpr const char Pacific_Pitcairn[] PROGMEM = "Pacific/Pitcairn";
-constexpr const char Pacific_Pohnpei[] PROGMEM = "Pacific/Pohnpei";
-constexpr const char Pacific_Port_Moresby[] PROGMEM = "Pacific/Port_Moresby";
-constexpr const char Pacific_Rarotonga[] PROGMEM = "Pacific/Rarotonga";
-constexpr const char Pacific_Saipan[] PROGMEM = "Pacific/Saipan";
-constexpr const char Pacific_Tahiti[] PROGMEM = "Pacific/Tahiti";
-constexpr const char Pacific_Tarawa[] PROGMEM = "Pacific/Tarawa";
-constexpr const char Pacific_Tongatapu[] PROGMEM = "Pacific/Tongatapu";
-constexpr const char Pacific_Wake[] PROGMEM = "Pacific/Wake";
-constexpr const char Pacific_Wallis[] PROGMEM = "Pacific/Wallis";
-constexpr const char Etc_GMT[] PROGMEM = "Etc/GMT";
-constexpr const char Etc_GMT_0[] PROGMEM = "Etc/GMT+0";
-constexpr const char Etc_GMT_1[] PROGMEM = "Etc/GMT+1";
-constexpr const char Etc_GMT_2[] PROGMEM = "Etc/GMT+2";
-constexpr const char Etc_GMT_3[] PROGMEM = "Etc/GMT+3";
-constexpr const char Etc_GMT_4[] PROGMEM = "Etc/GMT+4";
-constexpr const char Etc_GMT_5[] PROGMEM = "Etc/GMT+5";
-constexpr const char Etc_GMT_6[] PROGMEM = "Etc/GMT+6";
-constexpr const char Etc_GMT_7[] PROGMEM = "Etc/GMT+7";
-constexpr const char Etc_GMT_8[] PROGMEM = "Etc/GMT+8";
-constexpr const char Etc_GMT_9[] PROGMEM = "Etc/GMT+9";
-constexpr const char Etc_GMT_10[] PROGMEM = "Etc/GMT+10";
-constexpr const char Etc_GMT_11[] PROGMEM = "Etc/GMT+11";
-constexpr const char Etc_GMT_12[] PROGMEM = "Etc/GMT+12";
-constexpr const char Etc_GMT_13[] PROGMEM = "Etc/GMT-13";
-constexpr const char Etc_GMT_14[] PROGMEM = "Etc/GMT-14";
-constexpr const char Etc_GMT0[] PROGMEM = "Etc/GMT0";
-constexpr const char Etc_UCT[] PROGMEM = "Etc/UCT";
-constexpr const char Etc_UTC[] PROGMEM = "Etc/UTC";
-constexpr const char Etc_Greenwich[] PROGMEM = "Etc/Greenwich";
-constexpr const char Etc_Universal[] PROGMEM = "Etc/Universal";
-constexpr const char Etc_Zulu[] PROGMEM = "Etc/Zulu";
+// the names in sorted order followed by the distinct POSIX rules, every string is terminated by \0
+inline constexpr const char timezonePool[] PROGMEM =
+    "Africa/Abidjan\0"
+    "Africa/Accra\0"
+    "Africa/Addis_Ababa\0"
+    "Africa/Algiers\0"
+    "Africa/Asmara\0"
+    "Africa/Bamako\0"
+    "Africa/Bangui\0"
+    "Africa/Banjul\0"
+    "Africa/Bissau\0"
+    "Africa/Blantyre\0"
+    "Africa/Brazzaville\0"
+    "Africa/Bujumbura\0"
+    "Africa/Cairo\0"
+    "Africa/Casablanca\0"
+    "Africa/Ceuta\0"
+    "Africa/Conakry\0"
+    "Africa/Dakar\0"
+    "Africa/Dar_es_Salaam\0"
+    "Africa/Djibouti\0"
+    "Africa/Douala\0"
+    "Africa/El_Aaiun\0"
+    "Africa/Freetown\0"
+    "Africa/Gaborone\0"
+    "Africa/Harare\0"
+    "Africa/Johannesburg\0"
+    "Africa/Juba\0"
+    "Africa/Kampala\0"
+    "Africa/Khartoum\0"
+    "Africa/Kigali\0"
+    "Africa/Kinshasa\0"
+    "Africa/Lagos\0"
+    "Africa/Libreville\0"
+    "Africa/Lome\0"
+    "Africa/Luanda\0"
+    "Africa/Lubumbashi\0"
+    "Africa/Lusaka\0"
+    "Africa/Malabo\0"
+    "Africa/Maputo\0"
+    "Africa/Maseru\0"
+    "Africa/Mbabane\0"
+    "Africa/Mogadishu\0"
+    "Africa/Monrovia\0"
+    "Africa/Nairobi\0"
+    "Africa/Ndjamena\0"
+    "Africa/Niamey\0"
+    "Africa/Nouakchott\0"
+    "Africa/Ouagadougou\0"
+    "Africa/Porto-Novo\0"
+    "Africa/Sao_Tome\0"
+    "Africa/Tripoli\0"
+    "Africa/Tunis\0"
+    "Africa/Windhoek\0"
+    "America/Adak\0"
+    "America/Anchorage\0"
+    "America/Anguilla\0"
+    "America/Antigua\0"
+    "America/Araguaina\0"
+    "America/Argentina/Buenos_Aires\0"
+    "America/Argentina/Catamarca\0"
+    "America/Argentina/Cordoba\0"
+    "America/Argentina/Jujuy\0"
+    "America/Argentina/La_Rioja\0"
+    "America/Argentina/Mendoza\0"
+    "America/Argentina/Rio_Gallegos\0"
+    "America/Argentina/Salta\0"
+    "America/Argentina/San_Juan\0"
+    "America/Argentina/San_Luis\0"
+    "America/Argentina/Tucuman\0"
+    "America/Argentina/Ushuaia\0"
+    "America/Aruba\0"
+    "America/Asuncion\0"
+    "America/Atikokan\0"
+    "America/Bahia\0"
+    "America/Bahia_Banderas\0"
+    "America/Barbados\0"
+    "America/Belem\0"
+    "America/Belize\0"
+    "America/Blanc-Sablon\0"
+    "America/Boa_Vista\0"
+    "America/Bogota\0"
+    "America/Boise\0"
+    "America/Cambridge_Bay\0"
+    "America/Campo_Grande\0"
+    "America/Cancun\0"
+    "America/Caracas\0"
+    "America/Cayenne\0"
+    "America/Cayman\0"
+    "America/Chicago\0"
+    "America/Chihuahua\0"
+    "America/Costa_Rica\0"
+    "America/Creston\0"
+    "America/Cuiaba\0"
+    "America/Curacao\0"
+    "America/Danmarkshavn\0"
+    "America/Dawson\0"
+    "America/Dawson_Creek\0"
+    "America/Denver\0"
+    "America/Detroit\0"
+    "America/Dominica\0"
+    "America/Edmonton\0"
+    "America/Eirunepe\0"
+    "America/El_Salvador\0"
+    "America/Fort_Nelson\0"
+    "America/Fortaleza\0"
+    "America/Glace_Bay\0"
+    "America/Godthab\0"
+    "America/Goose_Bay\0"
+    "America/Grand_Turk\0"
+    "America/Grenada\0"
+    "America/Guadeloupe\0"
+    "America/Guatemala\0"
+    "America/Guayaquil\0"
+    "America/Guyana\0"
+    "America/Halifax\0"
+    "America/Havana\0"
+    "America/Hermosillo\0"
+    "America/Indiana/Indianapolis\0"
+    "America/Indiana/Knox\0"
+    "America/Indiana/Marengo\0"
+    "America/Indiana/Petersburg\0"
+    "America/Indiana/Tell_City\0"
+    "America/Indiana/Vevay\0"
+    "America/Indiana/Vincennes\0"
+    "America/Indiana/Winamac\0"
+    "America/Inuvik\0"
+    "America/Iqaluit\0"
+    "America/Jamaica\0"
+    "America/Juneau\0"
+    "America/Kentucky/Louisville\0"
+    "America/Kentucky/Monticello\0"
+    "America/Kralendijk\0"
+    "America/La_Paz\0"
+    "America/Lima\0"
+    "America/Los_Angeles\0"
+    "America/Lower_Princes\0"
+    "America/Maceio\0"
+    "America/Managua\0"
+    "America/Manaus\0"
+    "America/Marigot\0"
+    "America/Martinique\0"
+    "America/Matamoros\0"
+    "America/Mazatlan\0"
+    "America/Menominee\0"
+    "America/Merida\0"
+    "America/Metlakatla\0"
+    "America/Mexico_City\0"
+    "America/Miquelon\0"
+    "America/Moncton\0"
+    "America/Monterrey\0"
+    "America/Montevideo\0"
+    "America/Montreal\0"
+    "America/Montserrat\0"
+    "America/Nassau\0"
+    "America/New_York\0"
+    "America/Nipigon\0"
+    "America/Nome\0"
+    "America/Noronha\0"
+    "America/North_Dakota/Beulah\0"
+    "America/North_Dakota/Center\0"
+    "America/North_Dakota/New_Salem\0"
+    "America/Nuuk\0"
+    "America/Ojinaga\0"
+    "America/Panama\0"
+    "America/Pangnirtung\0"
+    "America/Paramaribo\0"
+    "America/Phoenix\0"
+    "America/Port-au-Prince\0"
+    "America/Port_of_Spain\0"
+    "America/Porto_Velho\0"
+    "America/Puerto_Rico\0"
+    "America/Punta_Arenas\0"
+    "America/Rainy_River\0"
+    "America/Rankin_Inlet\0"
+    "America/Recife\0"
+    "America/Regina\0"
+    "America/Resolute\0"
+    "America/Rio_Branco\0"
+    "America/Santarem\0"
+    "America/Santiago\0"
+    "America/Santo_Domingo\0"
+    "America/Sao_Paulo\0"
+    "America/Scoresbysund\0"
+    "America/Sitka\0"
+    "America/St_Barthelemy\0"
+    "America/St_Johns\0"
+    "America/St_Kitts\0"
+    "America/St_Lucia\0"
+    "America/St_Thomas\0"
+    "America/St_Vincent\0"
+    "America/Swift_Current\0"
+    "America/Tegucigalpa\0"
+    "America/Thule\0"
+    "America/Thunder_Bay\0"
+    "America/Tijuana\0"
+    "America/Toronto\0"
+    "America/Tortola\0"
+    "America/Vancouver\0"
+    "America/Whitehorse\0"
+    "America/Winnipeg\0"
+    "America/Yakutat\0"
+    "America/Yellowknife\0"
+    "Antarctica/Casey\0"
+    "Antarctica/Davis\0"
+    "Antarctica/DumontDUrville\0"
+    "Antarctica/Macquarie\0"
+    "Antarctica/Mawson\0"
+    "Antarctica/McMurdo\0"
+    "Antarctica/Palmer\0"
+    "Antarctica/Rothera\0"
+    "Antarctica/Syowa\0"
+    "Antarctica/Troll\0"
+    "Antarctica/Vostok\0"
+    "Arctic/Longyearbyen\0"
+    "Asia/Aden\0"
+    "Asia/Almaty\0"
+    "Asia/Amman\0"
+    "Asia/Anadyr\0"
+    "Asia/Aqtau\0"
+    "Asia/Aqtobe\0"
+    "Asia/Ashgabat\0"
+    "Asia/Atyrau\0"
+    "Asia/Baghdad\0"
+    "Asia/Bahrain\0"
+    "Asia/Baku\0"
+    "Asia/Bangkok\0"
+    "Asia/Barnaul\0"
+    "Asia/Beirut\0"
+    "Asia/Bishkek\0"
+    "Asia/Brunei\0"
+    "Asia/Chita\0"
+    "Asia/Choibalsan\0"
+    "Asia/Colombo\0"
+    "Asia/Damascus\0"
+    "Asia/Dhaka\0"
+    "Asia/Dili\0"
+    "Asia/Dubai\0"
+    "Asia/Dushanbe\0"
+    "Asia/Famagusta\0"
+    "Asia/Gaza\0"
+    "Asia/Hebron\0"
+    "Asia/Ho_Chi_Minh\0"
+    "Asia/Hong_Kong\0"
+    "Asia/Hovd\0"
+    "Asia/Irkutsk\0"
+    "Asia/Jakarta\0"
+    "Asia/Jayapura\0"
+    "Asia/Jerusalem\0"
+    "Asia/Kabul\0"
+    "Asia/Kamchatka\0"
+    "Asia/Karachi\0"
+    "Asia/Kathmandu\0"
+    "Asia/Khandyga\0"
+    "Asia/Kolkata\0"
+    "Asia/Krasnoyarsk\0"
+    "Asia/Kuala_Lumpur\0"
+    "Asia/Kuching\0"
+    "Asia/Kuwait\0"
+    "Asia/Macau\0"
+    "Asia/Magadan\0"
+    "Asia/Makassar\0"
+    "Asia/Manila\0"
+    "Asia/Muscat\0"
+    "Asia/Nicosia\0"
+    "Asia/Novokuznetsk\0"
+    "Asia/Novosibirsk\0"
+    "Asia/Omsk\0"
+    "Asia/Oral\0"
+    "Asia/Phnom_Penh\0"
+    "Asia/Pontianak\0"
+    "Asia/Pyongyang\0"
+    "Asia/Qatar\0"
+    "Asia/Qyzylorda\0"
+    "Asia/Riyadh\0"
+    "Asia/Sakhalin\0"
+    "Asia/Samarkand\0"
+    "Asia/Seoul\0"
+    "Asia/Shanghai\0"
+    "Asia/Singapore\0"
+    "Asia/Srednekolymsk\0"
+    "Asia/Taipei\0"
+    "Asia/Tashkent\0"
+    "Asia/Tbilisi\0"
+    "Asia/Tehran\0"
+    "Asia/Thimphu\0"
+    "Asia/Tokyo\0"
+    "Asia/Tomsk\0"
+    "Asia/Ulaanbaatar\0"
+    "Asia/Urumqi\0"
+    "Asia/Ust-Nera\0"
+    "Asia/Vientiane\0"
+    "Asia/Vladivostok\0"
+    "Asia/Yakutsk\0"
+    "Asia/Yangon\0"
+    "Asia/Yekaterinburg\0"
+    "Asia/Yerevan\0"
+    "Atlantic/Azores\0"
+    "Atlantic/Bermuda\0"
+    "Atlantic/Canary\0"
+    "Atlantic/Cape_Verde\0"
+    "Atlantic/Faroe\0"
+    "Atlantic/Madeira\0"
+    "Atlantic/Reykjavik\0"
+    "Atlantic/South_Georgia\0"
+    "Atlantic/St_Helena\0"
+    "Atlantic/Stanley\0"
+    "Australia/Adelaide\0"
+    "Australia/Brisbane\0"
+    "Australia/Broken_Hill\0"
+    "Australia/Currie\0"
+    "Australia/Darwin\0"
+    "Australia/Eucla\0"
+    "Australia/Hobart\0"
+    "Australia/Lindeman\0"
+    "Australia/Lord_Howe\0"
+    "Australia/Melbourne\0"
+    "Australia/Perth\0"
+    "Australia/Sydney\0"
+    "Etc/GMT\0"
+    "Etc/GMT+0\0"
+    "Etc/GMT+1\0"
+    "Etc/GMT+10\0"
+    "Etc/GMT+11\0"
+    "Etc/GMT+12\0"
+    "Etc/GMT+2\0"
+    "Etc/GMT+3\0"
+    "Etc/GMT+4\0"
+    "Etc/GMT+5\0"
+    "Etc/GMT+6\0"
+    "Etc/GMT+7\0"
+    "Etc/GMT+8\0"
+    "Etc/GMT+9\0"
+    "Etc/GMT-13\0"
+    "Etc/GMT-14\0"
+    "Etc/GMT0\0"
+    "Etc/Greenwich\0"
+    "Etc/UCT\0"
+    "Etc/UTC\0"
+    "Etc/Universal\0"
+    "Etc/Zulu\0"
+    "Europe/Amsterdam\0"
+    "Europe/Andorra\0"
+    "Europe/Astrakhan\0"
+    "Europe/Athens\0"
+    "Europe/Belgrade\0"
+    "Europe/Berlin\0"
+    "Europe/Bratislava\0"
+    "Europe/Brussels\0"
+    "Europe/Bucharest\0"
+    "Europe/Budapest\0"
+    "Europe/Busingen\0"
+    "Europe/Chisinau\0"
+    "Europe/Copenhagen\0"
+    "Europe/Dublin\0"
+    "Europe/Gibraltar\0"
+    "Europe/Guernsey\0"
+    "Europe/Helsinki\0"
+    "Europe/Isle_of_Man\0"
+    "Europe/Istanbul\0"
+    "Europe/Jersey\0"
+    "Europe/Kaliningrad\0"
+    "Europe/Kiev\0"
+    "Europe/Kirov\0"
+    "Europe/Lisbon\0"
+    "Europe/Ljubljana\0"
+    "Europe/London\0"
+    "Europe/Luxembourg\0"
+    "Europe/Madrid\0"
+    "Europe/Malta\0"
+    "Europe/Mariehamn\0"
+    "Europe/Minsk\0"
+    "Europe/Monaco\0"
+    "Europe/Moscow\0"
+    "Europe/Oslo\0"
+    "Europe/Paris\0"
+    "Europe/Podgorica\0"
+    "Europe/Prague\0"
+    "Europe/Riga\0"
+    "Europe/Rome\0"
+    "Europe/Samara\0"
+    "Europe/San_Marino\0"
+    "Europe/Sarajevo\0"
+    "Europe/Saratov\0"
+    "Europe/Simferopol\0"
+    "Europe/Skopje\0"
+    "Europe/Sofia\0"
+    "Europe/Stockholm\0"
+    "Europe/Tallinn\0"
+    "Europe/Tirane\0"
+    "Europe/Ulyanovsk\0"
+    "Europe/Uzhgorod\0"
+    "Europe/Vaduz\0"
+    "Europe/Vatican\0"
+    "Europe/Vienna\0"
+    "Europe/Vilnius\0"
+    "Europe/Volgograd\0"
+    "Europe/Warsaw\0"
+    "Europe/Zagreb\0"
+    "Europe/Zaporozhye\0"
+    "Europe/Zurich\0"
+    "Indian/Antananarivo\0"
+    "Indian/Chagos\0"
+    "Indian/Christmas\0"
+    "Indian/Cocos\0"
+    "Indian/Comoro\0"
+    "Indian/Kerguelen\0"
+    "Indian/Mahe\0"
+    "Indian/Maldives\0"
+    "Indian/Mauritius\0"
+    "Indian/Mayotte\0"
+    "Indian/Reunion\0"
+    "Pacific/Apia\0"
+    "Pacific/Auckland\0"
+    "Pacific/Bougainville\0"
+    "Pacific/Chatham\0"
+    "Pacific/Chuuk\0"
+    "Pacific/Easter\0"
+    "Pacific/Efate\0"
+    "Pacific/Enderbury\0"
+    "Pacific/Fakaofo\0"
+    "Pacific/Fiji\0"
+    "Pacific/Funafuti\0"
+    "Pacific/Galapagos\0"
+    "Pacific/Gambier\0"
+    "Pacific/Guadalcanal\0"
+    "Pacific/Guam\0"
+    "Pacific/Honolulu\0"
+    "Pacific/Kiritimati\0"
+    "Pacific/Kosrae\0"
+    "Pacific/Kwajalein\0"
+    "Pacific/Majuro\0"
+    "Pacific/Marquesas\0"
+    "Pacific/Midway\0"
+    "Pacific/Nauru\0"
+    "Pacific/Niue\0"
+    "Pacific/Norfolk\0"
+    "Pacific/Noumea\0"
+    "Pacific/Pago_Pago\0"
+    "Pacific/Palau\0"
+    "Pacific/Pitcairn\0"
+    "Pacific/Pohnpei\0"
+    "Pacific/Port_Moresby\0"
+    "Pacific/Rarotonga\0"
+    "Pacific/Saipan\0"
+    "Pacific/Tahiti\0"
+    "Pacific/Tarawa\0"
+    "Pacific/Tongatapu\0"
+    "Pacific/Wake\0"
+    "Pacific/Wallis\0"
+    "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3\0"
+    "<+01>-1\0"
+    "<+0330>-3:30<+0430>,J79/24,J263/24\0"
+    "<+03>-3\0"
+    "<+0430>-4:30\0"
+    "<+04>-4\0"
+    "<+0530>-5:30\0"
+    "<+0545>-5:45\0"
+    "<+05>-5\0"
+    "<+0630>-6:30\0"
+    "<+06>-6\0"
+    "<+07>-7\0"
+    "<+0845>-8:45\0"
+    "<+08>-8\0"
+    "<+09>-9\0"
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0\0"
+    "<+10>-10\0"
+    "<+11>-11\0"
+    "<+11>-11<+12>,M10.1.0,M4.1.0/3\0"
+    "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45\0"
+    "<+12>-12\0"
+    "<+12>-12<+13>,M11.2.0,M1.2.3/99\0"
+    "<+13>-13\0"
+    "<+14>-14\0"
+    "<-01>1\0"
+    "<-01>1<+00>,M3.5.0/0,M10.5.0/1\0"
+    "<-02>2\0"
+    "<-03>3\0"
+    "<-03>3<-02>,M3.2.0,M11.1.0\0"
+    "<-03>3<-02>,M3.5.0/-2,M10.5.0/-1\0"
+    "<-04>4\0"
+    "<-04>4<-03>,M10.1.0/0,M3.4.0/0\0"
+    "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+    "<-05>5\0"
+    "<-06>6\0"
+    "<-06>6<-05>,M9.1.6/22,M4.1.6/22\0"
+    "<-07>7\0"
+    "<-08>8\0"
+    "<-0930>9:30\0"
+    "<-09>9\0"
+    "<-10>10\0"
+    "<-11>11\0"
+    "<-12>12\0"
+    "ACST-9:30\0"
+    "ACST-9:30ACDT,M10.1.0,M4.1.0/3\0"
+    "AEST-10\0"
+    "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+    "AKST9AKDT,M3.2.0,M11.1.0\0"
+    "AST4\0"
+    "AST4ADT,M3.2.0,M11.1.0\0"
+    "AWST-8\0"
+    "CAT-2\0"
+    "CET-1\0"
+    "CET-1CEST,M3.5.0,M10.5.0/3\0"
+    "CST-8\0"
+    "CST5CDT,M3.2.0/0,M11.1.0/1\0"
+    "CST6\0"
+    "CST6CDT,M3.2.0,M11.1.0\0"
+    "CST6CDT,M4.1.0,M10.5.0\0"
+    "ChST-10\0"
+    "EAT-3\0"
+    "EET-2\0"
+    "EET-2EEST,M2.5.4/24,M10.5.5/1\0"
+    "EET-2EEST,M3.4.4/48,M10.5.5/1\0"
+    "EET-2EEST,M3.5.0,M10.5.0/3\0"
+    "EET-2EEST,M3.5.0/0,M10.5.0/0\0"
+    "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+    "EET-2EEST,M3.5.5/0,M10.5.5/0\0"
+    "EST5\0"
+    "EST5EDT,M3.2.0,M11.1.0\0"
+    "GMT0\0"
+    "GMT0BST,M3.5.0/1,M10.5.0\0"
+    "HKT-8\0"
+    "HST10\0"
+    "HST10HDT,M3.2.0,M11.1.0\0"
+    "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+    "IST-2IDT,M3.4.4/26,M10.5.0\0"
+    "IST-5:30\0"
+    "JST-9\0"
+    "KST-9\0"
+    "MSK-3\0"
+    "MST7\0"
+    "MST7MDT,M3.2.0,M11.1.0\0"
+    "MST7MDT,M4.1.0,M10.5.0\0"
+    "NST3:30NDT,M3.2.0,M11.1.0\0"
+    "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+    "PKT-5\0"
+    "PST-8\0"
+    "PST8PDT,M3.2.0,M11.1.0\0"
+    "SAST-2\0"
+    "SST11\0"
+    "UTC0\0"
+    "WAT-1\0"
+    "WET0WEST,M3.5.0/1,M10.5.0\0"
+    "WIB-7\0"
+    "WIT-9\0"
+    "WITA-8\0"
+    ;
 
+struct TimezoneEntry {
+    uint16_t name; // offsets into timezonePool
+    uint16_t rule;
+};
 
-// timezone codes
-constexpr const char GMT0[] PROGMEM = "GMT0";
-constexpr const char EATm3[] PROGMEM = "EAT-3";
-constexpr const char CETm1[] PROGMEM = "CET-1";
-constexpr const char WATm1[] PROGMEM = "WAT-1";
-constexpr const char CATm2[] PROGMEM = "CAT-2";
-constexpr const char EETm2[] PROGMEM = "EET-2";
-constexpr const char _p01_m1[] PROGMEM = "<+01>-1";
-constexpr const char CETm1CEST_M3_5_0_M10_5_0_3[] PROGMEM = "CET-1CEST,M3.5.0,M10.5.0/3";
-constexpr const char SASTm2[] PROGMEM = "SAST-2";
-constexpr const char HST10HDT_M3_2_0_M11_1_0[] PROGMEM = "HST10HDT,M3.2.0,M11.1.0";
-constexpr const char AKST9AKDT_M3_2_0_M11_1_0[] PROGMEM = "AKST9AKDT,M3.2.0,M11.1.0";
-constexpr const char AST4[] PROGMEM = "AST4";
-constexpr const char _m03_3[] PROGMEM = "<-03>3";
-constexpr const char _m04_4_m03__M10_1_0_0_M3_4_0_0[] PROGMEM = "<-04>4<-03>,M10.1.0/0,M3.4.0/0";
-constexpr const char EST5[] PROGMEM = "EST5";
-constexpr const char CST6CDT_M4_1_0_M10_5_0[] PROGMEM = "CST6CDT,M4.1.0,M10.5.0";
-constexpr const char CST6[] PROGMEM = "CST6";
-constexpr const char _m04_4[] PROGMEM = "<-04>4";
-constexpr const char _m05_5[] PROGMEM = "<-05>5";
-constexpr const char MST7MDT_M3_2_0_M11_1_0[] PROGMEM = "MST7MDT,M3.2.0,M11.1.0";
-constexpr const char CST6CDT_M3_2_0_M11_1_0[] PROGMEM = "CST6CDT,M3.2.0,M11.1.0";
-constexpr const char MST7MDT_M4_1_0_M10_5_0[] PROGMEM = "MST7MDT,M4.1.0,M10.5.0";
-constexpr const char MST7[] PROGMEM = "MST7";
-constexpr const char EST5EDT_M3_2_0_M11_1_0[] PROGMEM = "EST5EDT,M3.2.0,M11.1.0";
-constexpr const char AST4ADT_M3_2_0_M11_1_0[] PROGMEM = "AST4ADT,M3.2.0,M11.1.0";
-constexpr const char _m03_3_m02__M3_5_0_m2_M10_5_0_m1[] PROGMEM = "<-03>3<-02>,M3.5.0/-2,M10.5.0/-1";
-constexpr const char CST5CDT_M3_2_0_0_M11_1_0_1[] PROGMEM = "CST5CDT,M3.2.0/0,M11.1.0/1";
-constexpr const char PST8PDT_M3_2_0_M11_1_0[] PROGMEM = "PST8PDT,M3.2.0,M11.1.0";
-constexpr const char _m03_3_m02__M3_2_0_M11_1_0[] PROGMEM = "<-03>3<-02>,M3.2.0,M11.1.0";
-constexpr const char _m02_2[] PROGMEM = "<-02>2";
-constexpr const char _m04_4_m03__M9_1_6_24_M4_1_6_24[] PROGMEM = "<-04>4<-03>,M9.1.6/24,M4.1.6/24";
-constexpr const char _m01_1_p00__M3_5_0_0_M10_5_0_1[] PROGMEM = "<-01>1<+00>,M3.5.0/0,M10.5.0/1";
-constexpr const char NST3_30NDT_M3_2_0_M11_1_0[] PROGMEM = "NST3:30NDT,M3.2.0,M11.1.0";
-constexpr const char _p11_m11[] PROGMEM = "<+11>-11";
-constexpr const char _p07_m7[] PROGMEM = "<+07>-7";
-constexpr const char _p10_m10[] PROGMEM = "<+10>-10";
-constexpr const char AESTm10AEDT_M10_1_0_M4_1_0_3[] PROGMEM = "AEST-10AEDT,M10.1.0,M4.1.0/3";
-constexpr const char _p05_m5[] PROGMEM = "<+05>-5";
-constexpr const char NZSTm12NZDT_M9_5_0_M4_1_0_3[] PROGMEM = "NZST-12NZDT,M9.5.0,M4.1.0/3";
-constexpr const char _p03_m3[] PROGMEM = "<+03>-3";
-constexpr const char _p00_0_p02_m2_M3_5_0_1_M10_5_0_3[] PROGMEM = "<+00>0<+02>-2,M3.5.0/1,M10.5.0/3";
-constexpr const char _p06_m6[] PROGMEM = "<+06>-6";
-constexpr const char EETm2EEST_M2_5_4_24_M10_5_5_1[] PROGMEM = "EET-2EEST,M2.5.4/24,M10.5.5/1";
-constexpr const char _p12_m12[] PROGMEM = "<+12>-12";
-constexpr const char _p04_m4[] PROGMEM = "<+04>-4";
-constexpr const char EETm2EEST_M3_5_0_0_M10_5_0_0[] PROGMEM = "EET-2EEST,M3.5.0/0,M10.5.0/0";
-constexpr const char _p08_m8[] PROGMEM = "<+08>-8";
-constexpr const char _p09_m9[] PROGMEM = "<+09>-9";
-constexpr const char _p0530_m5_30[] PROGMEM = "<+0530>-5:30";
-constexpr const char EETm2EEST_M3_5_5_0_M10_5_5_0[] PROGMEM = "EET-2EEST,M3.5.5/0,M10.5.5/0";
-constexpr const char EETm2EEST_M3_5_0_3_M10_5_0_4[] PROGMEM = "EET-2EEST,M3.5.0/3,M10.5.0/4";
-constexpr const char EETm2EEST_M3_4_4_48_M10_5_5_1[] PROGMEM = "EET-2EEST,M3.4.4/48,M10.5.5/1";
-constexpr const char HKTm8[] PROGMEM = "HKT-8";
-constexpr const char WIBm7[] PROGMEM = "WIB-7";
-constexpr const char WITm9[] PROGMEM = "WIT-9";
-constexpr const char ISTm2IDT_M3_4_4_26_M10_5_0[] PROGMEM = "IST-2IDT,M3.4.4/26,M10.5.0";
-constexpr const char _p0430_m4_30[] PROGMEM = "<+0430>-4:30";
-constexpr const char PKTm5[] PROGMEM = "PKT-5";
-constexpr const char _p0545_m5_45[] PROGMEM = "<+0545>-5:45";
-constexpr const char ISTm5_30[] PROGMEM = "IST-5:30";
-constexpr const char CSTm8[] PROGMEM = "CST-8";
-constexpr const char WITAm8[] PROGMEM = "WITA-8";
-constexpr const char PSTm8[] PROGMEM = "PST-8";
-constexpr const char KSTm9[] PROGMEM = "KST-9";
-constexpr const char _p0330_m3_30_p0430__J79_24_J263_24[] PROGMEM = "<+0330>-3:30<+0430>,J79/24,J263/24";
-constexpr const char JSTm9[] PROGMEM = "JST-9";
-constexpr const char _p0630_m6_30[] PROGMEM = "<+0630>-6:30";
-constexpr const char WET0WEST_M3_5_0_1_M10_5_0[] PROGMEM = "WET0WEST,M3.5.0/1,M10.5.0";
-constexpr const char _m01_1[] PROGMEM = "<-01>1";
-constexpr const char ACSTm9_30ACDT_M10_1_0_M4_1_0_3[] PROGMEM = "ACST-9:30ACDT,M10.1.0,M4.1.0/3";
-constexpr const char AESTm10[] PROGMEM = "AEST-10";
-constexpr const char ACSTm9_30[] PROGMEM = "ACST-9:30";
-constexpr const char _p0845_m8_45[] PROGMEM = "<+0845>-8:45";
-constexpr const char _p1030_m10_30_p11_m11_M10_1_0_M4_1_0[] PROGMEM = "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0";
-constexpr const char AWSTm8[] PROGMEM = "AWST-8";
-constexpr const char EETm2EEST_M3_5_0_M10_5_0_3[] PROGMEM = "EET-2EEST,M3.5.0,M10.5.0/3";
-constexpr const char ISTm1GMT0_M10_5_0_M3_5_0_1[] PROGMEM = "IST-1GMT0,M10.5.0,M3.5.0/1";
-constexpr const char GMT0BST_M3_5_0_1_M10_5_0[] PROGMEM = "GMT0BST,M3.5.0/1,M10.5.0";
-constexpr const char MSKm3[] PROGMEM = "MSK-3";
-constexpr const char _p13_m13[] PROGMEM = "<+13>-13";
-constexpr const char _p1245_m12_45_p1345__M9_5_0_2_45_M4_1_0_3_45[] PROGMEM = "<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45";
-constexpr const char _m06_6_m05__M9_1_6_22_M4_1_6_22[] PROGMEM = "<-06>6<-05>,M9.1.6/22,M4.1.6/22";
-constexpr const char _p12_m12_p13__M11_2_0_M1_2_3_99[] PROGMEM = "<+12>-12<+13>,M11.2.0,M1.2.3/99";
-constexpr const char _m06_6[] PROGMEM = "<-06>6";
-constexpr const char _m09_9[] PROGMEM = "<-09>9";
-constexpr const char ChSTm10[] PROGMEM = "ChST-10";
-constexpr const char HST10[] PROGMEM = "HST10";
-constexpr const char _p14_m14[] PROGMEM = "<+14>-14";
-constexpr const char _m0930_9_30[] PROGMEM = "<-0930>9:30";
-constexpr const char SST11[] PROGMEM = "SST11";
-constexpr const char _m11_11[] PROGMEM = "<-11>11";
-constexpr const char _p11_m11_p12__M10_1_0_M4_1_0_3[] PROGMEM = "<+11>-11<+12>,M10.1.0,M4.1.0/3";
-constexpr const char _m08_8[] PROGMEM = "<-08>8";
-constexpr const char _m10_10[] PROGMEM = "<-10>10";
-constexpr const char _p02_m2[] PROGMEM = "<+02>-2";
-constexpr const char _m07_7[] PROGMEM = "<-07>7";
-constexpr const char _m12_12[] PROGMEM = "<-12>12";
-constexpr const char UTC0[] PROGMEM = "UTC0";
+// sorted by name
+inline constexpr TimezoneEntry timezoneTable[] PROGMEM = {
+    {0, 8412}, // Africa/Abidjan
+    {15, 8412}, // Africa/Accra
+    {28, 8198}, // Africa/Addis_Ababa
+    {47, 8073}, // Africa/Algiers
+    {62, 8198}, // Africa/Asmara
+    {76, 8412}, // Africa/Bamako
+    {90, 8717}, // Africa/Bangui
+    {104, 8412}, // Africa/Banjul
+    {118, 8412}, // Africa/Bissau
+    {132, 8067}, // Africa/Blantyre
+    {148, 8717}, // Africa/Brazzaville
+    {167, 8067}, // Africa/Bujumbura
+    {184, 8204}, // Africa/Cairo
+    {197, 7290}, // Africa/Casablanca
+    {215, 8079}, // Africa/Ceuta
+    {228, 8412}, // Africa/Conakry
+    {243, 8412}, // Africa/Dakar
+    {256, 8198}, // Africa/Dar_es_Salaam
+    {277, 8198}, // Africa/Djibouti
+    {293, 8717}, // Africa/Douala
+    {307, 7290}, // Africa/El_Aaiun
+    {323, 8412}, // Africa/Freetown
+    {339, 8067}, // Africa/Gaborone
+    {355, 8067}, // Africa/Harare
+    {369, 8699}, // Africa/Johannesburg
+    {389, 8067}, // Africa/Juba
+    {401, 8198}, // Africa/Kampala
+    {416, 8067}, // Africa/Khartoum
+    {432, 8067}, // Africa/Kigali
+    {446, 8717}, // Africa/Kinshasa
+    {462, 8717}, // Africa/Lagos
+    {475, 8717}, // Africa/Libreville
+    {493, 8412}, // Africa/Lome
+    {505, 8717}, // Africa/Luanda
+    {519, 8067}, // Africa/Lubumbashi
+    {537, 8067}, // Africa/Lusaka
+    {551, 8717}, // Africa/Malabo
+    {565, 8067}, // Africa/Maputo
+    {579, 8699}, // Africa/Maseru
+    {593, 8699}, // Africa/Mbabane
+    {608, 8198}, // Africa/Mogadishu
+    {625, 8412}, // Africa/Monrovia
+    {641, 8198}, // Africa/Nairobi
+    {656, 8717}, // Africa/Ndjamena
+    {672, 8717}, // Africa/Niamey
+    {686, 8412}, // Africa/Nouakchott
+    {704, 8412}, // Africa/Ouagadougou
+    {723, 8717}, // Africa/Porto-Novo
+    {741, 8412}, // Africa/Sao_Tome
+    {757, 8204}, // Africa/Tripoli
+    {772, 8073}, // Africa/Tunis
+    {785, 8067}, // Africa/Windhoek
+    {801, 8454}, // America/Adak
+    {814, 8007}, // America/Anchorage
+    {832, 8032}, // America/Anguilla
+    {849, 8032}, // America/Antigua
+    {865, 7689}, // America/Araguaina
+    {883, 7689}, // America/Argentina/Buenos_Aires
+    {914, 7689}, // America/Argentina/Catamarca
+    {942, 7689}, // America/Argentina/Cordoba
+    {968, 7689}, // America/Argentina/Jujuy
+    {992, 7689}, // America/Argentina/La_Rioja
+    {1019, 7689}, // America/Argentina/Mendoza
+    {1045, 7689}, // America/Argentina/Rio_Gallegos
+    {1076, 7689}, // America/Argentina/Salta
+    {1100, 7689}, // America/Argentina/San_Juan
+    {1127, 7689}, // America/Argentina/San_Luis
+    {1154, 7689}, // America/Argentina/Tucuman
+    {1180, 7689}, // America/Argentina/Ushuaia
+    {1206, 8032}, // America/Aruba
+    {1220, 7763}, // America/Asuncion
+    {1237, 8384}, // America/Atikokan
+    {1254, 7689}, // America/Bahia
+    {1268, 8167}, // America/Bahia_Banderas
+    {1291, 8032}, // America/Barbados
+    {1308, 7689}, // America/Belem
+    {1322, 8139}, // America/Belize
+    {1337, 8032}, // America/Blanc-Sablon
+    {1358, 7756}, // America/Boa_Vista
+    {1376, 7826}, // America/Bogota
+    {1391, 8564}, // America/Boise
+    {1405, 8564}, // America/Cambridge_Bay
+    {1427, 7756}, // America/Campo_Grande
+    {1448, 8384}, // America/Cancun
+    {1463, 7756}, // America/Caracas
+    {1479, 7689}, // America/Cayenne
+    {1495, 8384}, // America/Cayman
+    {1510, 8144}, // America/Chicago
+    {1526, 8587}, // America/Chihuahua
+    {1544, 8139}, // America/Costa_Rica
+    {1563, 8559}, // America/Creston
+    {1579, 7756}, // America/Cuiaba
+    {1594, 8032}, // America/Curacao
+    {1610, 8412}, // America/Danmarkshavn
+    {1631, 8559}, // America/Dawson
+    {1646, 8559}, // America/Dawson_Creek
+    {1667, 8564}, // America/Denver
+    {1682, 8389}, // America/Detroit
+    {1698, 8032}, // America/Dominica
+    {1715, 8564}, // America/Edmonton
+    {1732, 7826}, // America/Eirunepe
+    {1749, 8139}, // America/El_Salvador
+    {1769, 8559}, // America/Fort_Nelson
+    {1789, 7689}, // America/Fortaleza
+    {1807, 8037}, // America/Glace_Bay
+    {1825, 7723}, // America/Godthab
+    {1841, 8037}, // America/Goose_Bay
+    {1859, 8389}, // America/Grand_Turk
+    {1878, 8032}, // America/Grenada
+    {1894, 8032}, // America/Guadeloupe
+    {1913, 8139}, // America/Guatemala
+    {1931, 7826}, // America/Guayaquil
+    {1949, 7756}, // America/Guyana
+    {1964, 8037}, // America/Halifax
+    {1980, 8112}, // America/Havana
+    {1995, 8559}, // America/Hermosillo
+    {2014, 8389}, // America/Indiana/Indianapolis
+    {2043, 8144}, // America/Indiana/Knox
+    {2064, 8389}, // America/Indiana/Marengo
+    {2088, 8389}, // America/Indiana/Petersburg
+    {2115, 8144}, // America/Indiana/Tell_City
+    {2141, 8389}, // America/Indiana/Vevay
+    {2163, 8389}, // America/Indiana/Vincennes
+    {2189, 8389}, // America/Indiana/Winamac
+    {2213, 8564}, // America/Inuvik
+    {2228, 8389}, // America/Iqaluit
+    {2244, 8384}, // America/Jamaica
+    {2260, 8007}, // America/Juneau
+    {2275, 8389}, // America/Kentucky/Louisville
+    {2303, 8389}, // America/Kentucky/Monticello
+    {2331, 8032}, // America/Kralendijk
+    {2350, 7756}, // America/La_Paz
+    {2365, 7826}, // America/Lima
+    {2378, 8676}, // America/Los_Angeles
+    {2398, 8032}, // America/Lower_Princes
+    {2420, 7689}, // America/Maceio
+    {2435, 8139}, // America/Managua
+    {2451, 7756}, // America/Manaus
+    {2466, 8032}, // America/Marigot
+    {2482, 8032}, // America/Martinique
+    {2501, 8144}, // America/Matamoros
+    {2519, 8587}, // America/Mazatlan
+    {2536, 8144}, // America/Menominee
+    {2554, 8167}, // America/Merida
+    {2569, 8007}, // America/Metlakatla
+    {2588, 8167}, // America/Mexico_City
+    {2608, 7696}, // America/Miquelon
+    {2625, 8037}, // America/Moncton
+    {2641, 8167}, // America/Monterrey
+    {2659, 7689}, // America/Montevideo
+    {2678, 8389}, // America/Montreal
+    {2695, 8032}, // America/Montserrat
+    {2714, 8389}, // America/Nassau
+    {2729, 8389}, // America/New_York
+    {2746, 8389}, // America/Nipigon
+    {2762, 8007}, // America/Nome
+    {2775, 7682}, // America/Noronha
+    {2791, 8144}, // America/North_Dakota/Beulah
+    {2819, 8144}, // America/North_Dakota/Center
+    {2847, 8144}, // America/North_Dakota/New_Salem
+    {2878, 7723}, // America/Nuuk
+    {2891, 8564}, // America/Ojinaga
+    {2907, 8384}, // America/Panama
+    {2922, 8389}, // America/Pangnirtung
+    {2942, 7689}, // America/Paramaribo
+    {2961, 8559}, // America/Phoenix
+    {2977, 8389}, // America/Port-au-Prince
+    {3000, 8032}, // America/Port_of_Spain
+    {3022, 7756}, // America/Porto_Velho
+    {3042, 8032}, // America/Puerto_Rico
+    {3062, 7689}, // America/Punta_Arenas
+    {3083, 8144}, // America/Rainy_River
+    {3103, 8144}, // America/Rankin_Inlet
+    {3124, 7689}, // America/Recife
+    {3139, 8139}, // America/Regina
+    {3154, 8144}, // America/Resolute
+    {3171, 7826}, // America/Rio_Branco
+    {3190, 7689}, // America/Santarem
+    {3207, 7794}, // America/Santiago
+    {3224, 8032}, // America/Santo_Domingo
+    {3246, 7689}, // America/Sao_Paulo
+    {3264, 7651}, // America/Scoresbysund
+    {3285, 8007}, // America/Sitka
+    {3299, 8032}, // America/St_Barthelemy
+    {3321, 8610}, // America/St_Johns
+    {3338, 8032}, // America/St_Kitts
+    {3355, 8032}, // America/St_Lucia
+    {3372, 8032}, // America/St_Thomas
+    {3390, 8032}, // America/St_Vincent
+    {3409, 8139}, // America/Swift_Current
+    {3431, 8139}, // America/Tegucigalpa
+    {3451, 8037}, // America/Thule
+    {3465, 8389}, // America/Thunder_Bay
+    {3485, 8676}, // America/Tijuana
+    {3501, 8389}, // America/Toronto
+    {3517, 8032}, // America/Tortola
+    {3533, 8676}, // America/Vancouver
+    {3551, 8559}, // America/Whitehorse
+    {3570, 8144}, // America/Winnipeg
+    {3587, 8007}, // America/Yakutat
+    {3603, 8564}, // America/Yellowknife
+    {3623, 7500}, // Antarctica/Casey
+    {3640, 7417}, // Antarctica/Davis
+    {3657, 7491}, // Antarctica/DumontDUrville
+    {3683, 7978}, // Antarctica/Macquarie
+    {3704, 7388}, // Antarctica/Mawson
+    {3722, 8636}, // Antarctica/McMurdo
+    {3741, 7689}, // Antarctica/Palmer
+    {3759, 7689}, // Antarctica/Rothera
+    {3778, 7333}, // Antarctica/Syowa
+    {3795, 7257}, // Antarctica/Troll
+    {3812, 7409}, // Antarctica/Vostok
+    {3830, 8079}, // Arctic/Longyearbyen
+    {3850, 7333}, // Asia/Aden
+    {3860, 7409}, // Asia/Almaty
+    {3872, 8210}, // Asia/Amman
+    {3883, 7585}, // Asia/Anadyr
+    {3895, 7388}, // Asia/Aqtau
+    {3906, 7388}, // Asia/Aqtobe
+    {3918, 7388}, // Asia/Ashgabat
+    {3932, 7388}, // Asia/Atyrau
+    {3944, 7333}, // Asia/Baghdad
+    {3957, 7333}, // Asia/Bahrain
+    {3970, 7354}, // Asia/Baku
+    {3980, 7417}, // Asia/Bangkok
+    {3993, 7417}, // Asia/Barnaul
+    {4006, 8297}, // Asia/Beirut
+    {4018, 7409}, // Asia/Bishkek
+    {4031, 7438}, // Asia/Brunei
+    {4043, 7446}, // Asia/Chita
+    {4054, 7438}, // Asia/Choibalsan
+    {4070, 7362}, // Asia/Colombo
+    {4083, 8355}, // Asia/Damascus
+    {4097, 7409}, // Asia/Dhaka
+    {4108, 7446}, // Asia/Dili
+    {4118, 7354}, // Asia/Dubai
+    {4129, 7388}, // Asia/Dushanbe
+    {4143, 8326}, // Asia/Famagusta
+    {4158, 8240}, // Asia/Gaza
+    {4168, 8240}, // Asia/Hebron
+    {4180, 7417}, // Asia/Ho_Chi_Minh
+    {4197, 8442}, // Asia/Hong_Kong
+    {4212, 7417}, // Asia/Hovd
+    {4222, 7438}, // Asia/Irkutsk
+    {4235, 8749}, // Asia/Jakarta
+    {4248, 8755}, // Asia/Jayapura
+    {4262, 8505}, // Asia/Jerusalem
+    {4277, 7341}, // Asia/Kabul
+    {4288, 7585}, // Asia/Kamchatka
+    {4303, 8664}, // Asia/Karachi
+    {4316, 7375}, // Asia/Kathmandu
+    {4331, 7446}, // Asia/Khandyga
+    {4345, 8532}, // Asia/Kolkata
+    {4358, 7417}, // Asia/Krasnoyarsk
+    {4375, 7438}, // Asia/Kuala_Lumpur
+    {4393, 7438}, // Asia/Kuching
+    {4406, 7333}, // Asia/Kuwait
+    {4418, 8106}, // Asia/Macau
+    {4429, 7500}, // Asia/Magadan
+    {4442, 8761}, // Asia/Makassar
+    {4456, 8670}, // Asia/Manila
+    {4468, 7354}, // Asia/Muscat
+    {4480, 8326}, // Asia/Nicosia
+    {4493, 7417}, // Asia/Novokuznetsk
+    {4511, 7417}, // Asia/Novosibirsk
+    {4528, 7409}, // Asia/Omsk
+    {4538, 7388}, // Asia/Oral
+    {4548, 7417}, // Asia/Phnom_Penh
+    {4564, 8749}, // Asia/Pontianak
+    {4579, 8547}, // Asia/Pyongyang
+    {4594, 7333}, // Asia/Qatar
+    {4605, 7388}, // Asia/Qyzylorda
+    {4620, 7333}, // Asia/Riyadh
+    {4632, 7500}, // Asia/Sakhalin
+    {4646, 7388}, // Asia/Samarkand
+    {4661, 8547}, // Asia/Seoul
+    {4672, 8106}, // Asia/Shanghai
+    {4686, 7438}, // Asia/Singapore
+    {4701, 7500}, // Asia/Srednekolymsk
+    {4720, 8106}, // Asia/Taipei
+    {4732, 7388}, // Asia/Tashkent
+    {4746, 7354}, // Asia/Tbilisi
+    {4759, 7298}, // Asia/Tehran
+    {4771, 7409}, // Asia/Thimphu
+    {4784, 8541}, // Asia/Tokyo
+    {4795, 7417}, // Asia/Tomsk
+    {4806, 7438}, // Asia/Ulaanbaatar
+    {4823, 7409}, // Asia/Urumqi
+    {4835, 7491}, // Asia/Ust-Nera
+    {4849, 7417}, // Asia/Vientiane
+    {4864, 7491}, // Asia/Vladivostok
+    {4881, 7446}, // Asia/Yakutsk
+    {4894, 7396}, // Asia/Yangon
+    {4906, 7388}, // Asia/Yekaterinburg
+    {4925, 7354}, // Asia/Yerevan
+    {4938, 7651}, // Atlantic/Azores
+    {4954, 8037}, // Atlantic/Bermuda
+    {4971, 8723}, // Atlantic/Canary
+    {4987, 7644}, // Atlantic/Cape_Verde
+    {5007, 8723}, // Atlantic/Faroe
+    {5022, 8723}, // Atlantic/Madeira
+    {5039, 8412}, // Atlantic/Reykjavik
+    {5058, 7682}, // Atlantic/South_Georgia
+    {5081, 8412}, // Atlantic/St_Helena
+    {5100, 7689}, // Atlantic/Stanley
+    {5117, 7939}, // Australia/Adelaide
+    {5136, 7970}, // Australia/Brisbane
+    {5155, 7939}, // Australia/Broken_Hill
+    {5177, 7978}, // Australia/Currie
+    {5194, 7929}, // Australia/Darwin
+    {5211, 7425}, // Australia/Eucla
+    {5227, 7978}, // Australia/Hobart
+    {5244, 7970}, // Australia/Lindeman
+    {5263, 7454}, // Australia/Lord_Howe
+    {5283, 7978}, // Australia/Melbourne
+    {5303, 8060}, // Australia/Perth
+    {5319, 7978}, // Australia/Sydney
+    {5336, 8412}, // Etc/GMT
+    {5344, 8412}, // Etc/GMT+0
+    {5354, 7644}, // Etc/GMT+1
+    {5364, 7905}, // Etc/GMT+10
+    {5375, 7913}, // Etc/GMT+11
+    {5386, 7921}, // Etc/GMT+12
+    {5397, 7682}, // Etc/GMT+2
+    {5407, 7689}, // Etc/GMT+3
+    {5417, 7756}, // Etc/GMT+4
+    {5427, 7826}, // Etc/GMT+5
+    {5437, 7833}, // Etc/GMT+6
+    {5447, 7872}, // Etc/GMT+7
+    {5457, 7879}, // Etc/GMT+8
+    {5467, 7898}, // Etc/GMT+9
+    {5477, 7626}, // Etc/GMT-13
+    {5488, 7635}, // Etc/GMT-14
+    {5499, 8412}, // Etc/GMT0
+    {5508, 8412}, // Etc/Greenwich
+    {5522, 8712}, // Etc/UCT
+    {5530, 8712}, // Etc/UTC
+    {5538, 8712}, // Etc/Universal
+    {5552, 8712}, // Etc/Zulu
+    {5561, 8079}, // Europe/Amsterdam
+    {5578, 8079}, // Europe/Andorra
+    {5593, 7354}, // Europe/Astrakhan
+    {5610, 8326}, // Europe/Athens
+    {5624, 8079}, // Europe/Belgrade
+    {5640, 8079}, // Europe/Berlin
+    {5654, 8079}, // Europe/Bratislava
+    {5672, 8079}, // Europe/Brussels
+    {5688, 8326}, // Europe/Bucharest
+    {5705, 8079}, // Europe/Budapest
+    {5721, 8079}, // Europe/Busingen
+    {5737, 8270}, // Europe/Chisinau
+    {5753, 8079}, // Europe/Copenhagen
+    {5771, 8478}, // Europe/Dublin
+    {5785, 8079}, // Europe/Gibraltar
+    {5802, 8417}, // Europe/Guernsey
+    {5818, 8326}, // Europe/Helsinki
+    {5834, 8417}, // Europe/Isle_of_Man
+    {5853, 7333}, // Europe/Istanbul
+    {5869, 8417}, // Europe/Jersey
+    {5883, 8204}, // Europe/Kaliningrad
+    {5902, 8326}, // Europe/Kiev
+    {5914, 7333}, // Europe/Kirov
+    {5927, 8723}, // Europe/Lisbon
+    {5941, 8079}, // Europe/Ljubljana
+    {5958, 8417}, // Europe/London
+    {5972, 8079}, // Europe/Luxembourg
+    {5990, 8079}, // Europe/Madrid
+    {6004, 8079}, // Europe/Malta
+    {6017, 8326}, // Europe/Mariehamn
+    {6034, 7333}, // Europe/Minsk
+    {6047, 8079}, // Europe/Monaco
+    {6061, 8553}, // Europe/Moscow
+    {6075, 8079}, // Europe/Oslo
+    {6087, 8079}, // Europe/Paris
+    {6100, 8079}, // Europe/Podgorica
+    {6117, 8079}, // Europe/Prague
+    {6131, 8326}, // Europe/Riga
+    {6143, 8079}, // Europe/Rome
+    {6155, 7354}, // Europe/Samara
+    {6169, 8079}, // Europe/San_Marino
+    {6187, 8079}, // Europe/Sarajevo
+    {6203, 7354}, // Europe/Saratov
+    {6218, 8553}, // Europe/Simferopol
+    {6236, 8079}, // Europe/Skopje
+    {6250, 8326}, // Europe/Sofia
+    {6263, 8079}, // Europe/Stockholm
+    {6280, 8326}, // Europe/Tallinn
+    {6295, 8079}, // Europe/Tirane
+    {6309, 7354}, // Europe/Ulyanovsk
+    {6326, 8326}, // Europe/Uzhgorod
+    {6342, 8079}, // Europe/Vaduz
+    {6355, 8079}, // Europe/Vatican
+    {6370, 8079}, // Europe/Vienna
+    {6384, 8326}, // Europe/Vilnius
+    {6399, 7333}, // Europe/Volgograd
+    {6416, 8079}, // Europe/Warsaw
+    {6430, 8079}, // Europe/Zagreb
+    {6444, 8326}, // Europe/Zaporozhye
+    {6462, 8079}, // Europe/Zurich
+    {6476, 8198}, // Indian/Antananarivo
+    {6496, 7409}, // Indian/Chagos
+    {6510, 7417}, // Indian/Christmas
+    {6527, 7396}, // Indian/Cocos
+    {6540, 8198}, // Indian/Comoro
+    {6554, 7388}, // Indian/Kerguelen
+    {6571, 7354}, // Indian/Mahe
+    {6583, 7388}, // Indian/Maldives
+    {6599, 7354}, // Indian/Mauritius
+    {6616, 8198}, // Indian/Mayotte
+    {6631, 7354}, // Indian/Reunion
+    {6646, 7626}, // Pacific/Apia
+    {6659, 8636}, // Pacific/Auckland
+    {6676, 7500}, // Pacific/Bougainville
+    {6697, 7540}, // Pacific/Chatham
+    {6713, 7491}, // Pacific/Chuuk
+    {6727, 7840}, // Pacific/Easter
+    {6742, 7500}, // Pacific/Efate
+    {6756, 7626}, // Pacific/Enderbury
+    {6774, 7626}, // Pacific/Fakaofo
+    {6790, 7594}, // Pacific/Fiji
+    {6803, 7585}, // Pacific/Funafuti
+    {6820, 7833}, // Pacific/Galapagos
+    {6838, 7898}, // Pacific/Gambier
+    {6854, 7500}, // Pacific/Guadalcanal
+    {6874, 8190}, // Pacific/Guam
+    {6887, 8448}, // Pacific/Honolulu
+    {6904, 7635}, // Pacific/Kiritimati
+    {6923, 7500}, // Pacific/Kosrae
+    {6938, 7585}, // Pacific/Kwajalein
+    {6956, 7585}, // Pacific/Majuro
+    {6971, 7886}, // Pacific/Marquesas
+    {6989, 8706}, // Pacific/Midway
+    {7004, 7585}, // Pacific/Nauru
+    {7018, 7913}, // Pacific/Niue
+    {7031, 7509}, // Pacific/Norfolk
+    {7047, 7500}, // Pacific/Noumea
+    {7062, 8706}, // Pacific/Pago_Pago
+    {7080, 7446}, // Pacific/Palau
+    {7094, 7879}, // Pacific/Pitcairn
+    {7111, 7500}, // Pacific/Pohnpei
+    {7127, 7491}, // Pacific/Port_Moresby
+    {7148, 7905}, // Pacific/Rarotonga
+    {7166, 8190}, // Pacific/Saipan
+    {7181, 7905}, // Pacific/Tahiti
+    {7196, 7585}, // Pacific/Tarawa
+    {7211, 7626}, // Pacific/Tongatapu
+    {7229, 7585}, // Pacific/Wake
+    {7242, 7585}, // Pacific/Wallis
+};
 
+// index of the legacy table -> index of timezoneTable
+inline constexpr uint16_t timezoneLegacyIndex[] PROGMEM = {
+    0, // Africa/Abidjan
+    1, // Africa/Accra
+    2, // Africa/Addis_Ababa
+    3, // Africa/Algiers
+    4, // Africa/Asmara
+    5, // Africa/Bamako
+    6, // Africa/Bangui
+    7, // Africa/Banjul
+    8, // Africa/Bissau
+    9, // Africa/Blantyre
+    10, // Africa/Brazzaville
+    11, // Africa/Bujumbura
+    12, // Africa/Cairo
+    13, // Africa/Casablanca
+    14, // Africa/Ceuta
+    15, // Africa/Conakry
+    16, // Africa/Dakar
+    17, // Africa/Dar_es_Salaam
+    18, // Africa/Djibouti
+    19, // Africa/Douala
+    20, // Africa/El_Aaiun
+    21, // Africa/Freetown
+    22, // Africa/Gaborone
+    23, // Africa/Harare
+    24, // Africa/Johannesburg
+    25, // Africa/Juba
+    26, // Africa/Kampala
+    27, // Africa/Khartoum
+    28, // Africa/Kigali
+    29, // Africa/Kinshasa
+    30, // Africa/Lagos
+    31, // Africa/Libreville
+    32, // Africa/Lome
+    33, // Africa/Luanda
+    34, // Africa/Lubumbashi
+    35, // Africa/Lusaka
+    36, // Africa/Malabo
+    37, // Africa/Maputo
+    38, // Africa/Maseru
+    39, // Africa/Mbabane
+    40, // Africa/Mogadishu
+    41, // Africa/Monrovia
+    42, // Africa/Nairobi
+    43, // Africa/Ndjamena
+    44, // Africa/Niamey
+    45, // Africa/Nouakchott
+    46, // Africa/Ouagadougou
+    47, // Africa/Porto-Novo
+    48, // Africa/Sao_Tome
+    49, // Africa/Tripoli
+    50, // Africa/Tunis
+    51, // Africa/Windhoek
+    52, // America/Adak
+    53, // America/Anchorage
+    54, // America/Anguilla
+    55, // America/Antigua
+    56, // America/Araguaina
+    57, // America/Argentina/Buenos_Aires
+    58, // America/Argentina/Catamarca
+    59, // America/Argentina/Cordoba
+    60, // America/Argentina/Jujuy
+    61, // America/Argentina/La_Rioja
+    62, // America/Argentina/Mendoza
+    63, // America/Argentina/Rio_Gallegos
+    64, // America/Argentina/Salta
+    65, // America/Argentina/San_Juan
+    66, // America/Argentina/San_Luis
+    67, // America/Argentina/Tucuman
+    68, // America/Argentina/Ushuaia
+    69, // America/Aruba
+    70, // America/Asuncion
+    71, // America/Atikokan
+    72, // America/Bahia
+    73, // America/Bahia_Banderas
+    74, // America/Barbados
+    75, // America/Belem
+    76, // America/Belize
+    77, // America/Blanc-Sablon
+    78, // America/Boa_Vista
+    79, // America/Bogota
+    80, // America/Boise
+    81, // America/Cambridge_Bay
+    82, // America/Campo_Grande
+    83, // America/Cancun
+    84, // America/Caracas
+    85, // America/Cayenne
+    86, // America/Cayman
+    87, // America/Chicago
+    88, // America/Chihuahua
+    89, // America/Costa_Rica
+    90, // America/Creston
+    91, // America/Cuiaba
+    92, // America/Curacao
+    93, // America/Danmarkshavn
+    94, // America/Dawson
+    95, // America/Dawson_Creek
+    96, // America/Denver
+    97, // America/Detroit
+    98, // America/Dominica
+    99, // America/Edmonton
+    100, // America/Eirunepe
+    101, // America/El_Salvador
+    103, // America/Fortaleza
+    102, // America/Fort_Nelson
+    104, // America/Glace_Bay
+    105, // America/Godthab
+    106, // America/Goose_Bay
+    107, // America/Grand_Turk
+    108, // America/Grenada
+    109, // America/Guadeloupe
+    110, // America/Guatemala
+    111, // America/Guayaquil
+    112, // America/Guyana
+    113, // America/Halifax
+    114, // America/Havana
+    115, // America/Hermosillo
+    116, // America/Indiana/Indianapolis
+    117, // America/Indiana/Knox
+    118, // America/Indiana/Marengo
+    119, // America/Indiana/Petersburg
+    120, // America/Indiana/Tell_City
+    121, // America/Indiana/Vevay
+    122, // America/Indiana/Vincennes
+    123, // America/Indiana/Winamac
+    124, // America/Inuvik
+    125, // America/Iqaluit
+    126, // America/Jamaica
+    127, // America/Juneau
+    128, // America/Kentucky/Louisville
+    129, // America/Kentucky/Monticello
+    130, // America/Kralendijk
+    131, // America/La_Paz
+    132, // America/Lima
+    133, // America/Los_Angeles
+    134, // America/Lower_Princes
+    135, // America/Maceio
+    136, // America/Managua
+    137, // America/Manaus
+    138, // America/Marigot
+    139, // America/Martinique
+    140, // America/Matamoros
+    141, // America/Mazatlan
+    142, // America/Menominee
+    143, // America/Merida
+    144, // America/Metlakatla
+    145, // America/Mexico_City
+    146, // America/Miquelon
+    147, // America/Moncton
+    148, // America/Monterrey
+    149, // America/Montevideo
+    150, // America/Montreal
+    151, // America/Montserrat
+    152, // America/Nassau
+    153, // America/New_York
+    154, // America/Nipigon
+    155, // America/Nome
+    156, // America/Noronha
+    157, // America/North_Dakota/Beulah
+    158, // America/North_Dakota/Center
+    159, // America/North_Dakota/New_Salem
+    160, // America/Nuuk
+    161, // America/Ojinaga
+    162, // America/Panama
+    163, // America/Pangnirtung
+    164, // America/Paramaribo
+    165, // America/Phoenix
+    166, // America/Port-au-Prince
+    167, // America/Port_of_Spain
+    168, // America/Porto_Velho
+    169, // America/Puerto_Rico
+    170, // America/Punta_Arenas
+    171, // America/Rainy_River
+    172, // America/Rankin_Inlet
+    173, // America/Recife
+    174, // America/Regina
+    175, // America/Resolute
+    176, // America/Rio_Branco
+    177, // America/Santarem
+    178, // America/Santiago
+    179, // America/Santo_Domingo
+    180, // America/Sao_Paulo
+    181, // America/Scoresbysund
+    182, // America/Sitka
+    183, // America/St_Barthelemy
+    184, // America/St_Johns
+    185, // America/St_Kitts
+    186, // America/St_Lucia
+    187, // America/St_Thomas
+    188, // America/St_Vincent
+    189, // America/Swift_Current
+    190, // America/Tegucigalpa
+    191, // America/Thule
+    192, // America/Thunder_Bay
+    193, // America/Tijuana
+    194, // America/Toronto
+    195, // America/Tortola
+    196, // America/Vancouver
+    197, // America/Whitehorse
+    198, // America/Winnipeg
+    199, // America/Yakutat
+    200, // America/Yellowknife
+    201, // Antarctica/Casey
+    202, // Antarctica/Davis
+    203, // Antarctica/DumontDUrville
+    204, // Antarctica/Macquarie
+    205, // Antarctica/Mawson
+    206, // Antarctica/McMurdo
+    207, // Antarctica/Palmer
+    208, // Antarctica/Rothera
+    209, // Antarctica/Syowa
+    210, // Antarctica/Troll
+    211, // Antarctica/Vostok
+    212, // Arctic/Longyearbyen
+    213, // Asia/Aden
+    214, // Asia/Almaty
+    215, // Asia/Amman
+    216, // Asia/Anadyr
+    217, // Asia/Aqtau
+    218, // Asia/Aqtobe
+    219, // Asia/Ashgabat
+    220, // Asia/Atyrau
+    221, // Asia/Baghdad
+    222, // Asia/Bahrain
+    223, // Asia/Baku
+    224, // Asia/Bangkok
+    225, // Asia/Barnaul
+    226, // Asia/Beirut
+    227, // Asia/Bishkek
+    228, // Asia/Brunei
+    229, // Asia/Chita
+    230, // Asia/Choibalsan
+    231, // Asia/Colombo
+    232, // Asia/Damascus
+    233, // Asia/Dhaka
+    234, // Asia/Dili
+    235, // Asia/Dubai
+    236, // Asia/Dushanbe
+    237, // Asia/Famagusta
+    238, // Asia/Gaza
+    239, // Asia/Hebron
+    240, // Asia/Ho_Chi_Minh
+    241, // Asia/Hong_Kong
+    242, // Asia/Hovd
+    243, // Asia/Irkutsk
+    244, // Asia/Jakarta
+    245, // Asia/Jayapura
+    246, // Asia/Jerusalem
+    247, // Asia/Kabul
+    248, // Asia/Kamchatka
+    249, // Asia/Karachi
+    250, // Asia/Kathmandu
+    251, // Asia/Khandyga
+    252, // Asia/Kolkata
+    253, // Asia/Krasnoyarsk
+    254, // Asia/Kuala_Lumpur
+    255, // Asia/Kuching
+    256, // Asia/Kuwait
+    257, // Asia/Macau
+    258, // Asia/Magadan
+    259, // Asia/Makassar
+    260, // Asia/Manila
+    261, // Asia/Muscat
+    262, // Asia/Nicosia
+    263, // Asia/Novokuznetsk
+    264, // Asia/Novosibirsk
+    265, // Asia/Omsk
+    266, // Asia/Oral
+    267, // Asia/Phnom_Penh
+    268, // Asia/Pontianak
+    269, // Asia/Pyongyang
+    270, // Asia/Qatar
+    271, // Asia/Qyzylorda
+    272, // Asia/Riyadh
+    273, // Asia/Sakhalin
+    274, // Asia/Samarkand
+    275, // Asia/Seoul
+    276, // Asia/Shanghai
+    277, // Asia/Singapore
+    278, // Asia/Srednekolymsk
+    279, // Asia/Taipei
+    280, // Asia/Tashkent
+    281, // Asia/Tbilisi
+    282, // Asia/Tehran
+    283, // Asia/Thimphu
+    284, // Asia/Tokyo
+    285, // Asia/Tomsk
+    286, // Asia/Ulaanbaatar
+    287, // Asia/Urumqi
+    288, // Asia/Ust-Nera
+    289, // Asia/Vientiane
+    290, // Asia/Vladivostok
+    291, // Asia/Yakutsk
+    292, // Asia/Yangon
+    293, // Asia/Yekaterinburg
+    294, // Asia/Yerevan
+    295, // Atlantic/Azores
+    296, // Atlantic/Bermuda
+    297, // Atlantic/Canary
+    298, // Atlantic/Cape_Verde
+    299, // Atlantic/Faroe
+    300, // Atlantic/Madeira
+    301, // Atlantic/Reykjavik
+    302, // Atlantic/South_Georgia
+    304, // Atlantic/Stanley
+    303, // Atlantic/St_Helena
+    305, // Australia/Adelaide
+    306, // Australia/Brisbane
+    307, // Australia/Broken_Hill
+    308, // Australia/Currie
+    309, // Australia/Darwin
+    310, // Australia/Eucla
+    311, // Australia/Hobart
+    312, // Australia/Lindeman
+    313, // Australia/Lord_Howe
+    314, // Australia/Melbourne
+    315, // Australia/Perth
+    316, // Australia/Sydney
+    339, // Europe/Amsterdam
+    340, // Europe/Andorra
+    341, // Europe/Astrakhan
+    342, // Europe/Athens
+    343, // Europe/Belgrade
+    344, // Europe/Berlin
+    345, // Europe/Bratislava
+    346, // Europe/Brussels
+    347, // Europe/Bucharest
+    348, // Europe/Budapest
+    349, // Europe/Busingen
+    350, // Europe/Chisinau
+    351, // Europe/Copenhagen
+    352, // Europe/Dublin
+    353, // Europe/Gibraltar
+    354, // Europe/Guernsey
+    355, // Europe/Helsinki
+    356, // Europe/Isle_of_Man
+    357, // Europe/Istanbul
+    358, // Europe/Jersey
+    359, // Europe/Kaliningrad
+    360, // Europe/Kiev
+    361, // Europe/Kirov
+    362, // Europe/Lisbon
+    363, // Europe/Ljubljana
+    364, // Europe/London
+    365, // Europe/Luxembourg
+    366, // Europe/Madrid
+    367, // Europe/Malta
+    368, // Europe/Mariehamn
+    369, // Europe/Minsk
+    370, // Europe/Monaco
+    371, // Europe/Moscow
+    372, // Europe/Oslo
+    373, // Europe/Paris
+    374, // Europe/Podgorica
+    375, // Europe/Prague
+    376, // Europe/Riga
+    377, // Europe/Rome
+    378, // Europe/Samara
+    379, // Europe/San_Marino
+    380, // Europe/Sarajevo
+    381, // Europe/Saratov
+    382, // Europe/Simferopol
+    383, // Europe/Skopje
+    384, // Europe/Sofia
+    385, // Europe/Stockholm
+    386, // Europe/Tallinn
+    387, // Europe/Tirane
+    388, // Europe/Ulyanovsk
+    389, // Europe/Uzhgorod
+    390, // Europe/Vaduz
+    391, // Europe/Vatican
+    392, // Europe/Vienna
+    393, // Europe/Vilnius
+    394, // Europe/Volgograd
+    395, // Europe/Warsaw
+    396, // Europe/Zagreb
+    397, // Europe/Zaporozhye
+    398, // Europe/Zurich
+    399, // Indian/Antananarivo
+    400, // Indian/Chagos
+    401, // Indian/Christmas
+    402, // Indian/Cocos
+    403, // Indian/Comoro
+    404, // Indian/Kerguelen
+    405, // Indian/Mahe
+    406, // Indian/Maldives
+    407, // Indian/Mauritius
+    408, // Indian/Mayotte
+    409, // Indian/Reunion
+    410, // Pacific/Apia
+    411, // Pacific/Auckland
+    412, // Pacific/Bougainville
+    413, // Pacific/Chatham
+    414, // Pacific/Chuuk
+    415, // Pacific/Easter
+    416, // Pacific/Efate
+    417, // Pacific/Enderbury
+    418, // Pacific/Fakaofo
+    419, // Pacific/Fiji
+    420, // Pacific/Funafuti
+    421, // Pacific/Galapagos
+    422, // Pacific/Gambier
+    423, // Pacific/Guadalcanal
+    424, // Pacific/Guam
+    425, // Pacific/Honolulu
+    426, // Pacific/Kiritimati
+    427, // Pacific/Kosrae
+    428, // Pacific/Kwajalein
+    429, // Pacific/Majuro
+    430, // Pacific/Marquesas
+    431, // Pacific/Midway
+    432, // Pacific/Nauru
+    433, // Pacific/Niue
+    434, // Pacific/Norfolk
+    435, // Pacific/Noumea
+    436, // Pacific/Pago_Pago
+    437, // Pacific/Palau
+    438, // Pacific/Pitcairn
+    439, // Pacific/Pohnpei
+    440, // Pacific/Port_Moresby
+    441, // Pacific/Rarotonga
+    442, // Pacific/Saipan
+    443, // Pacific/Tahiti
+    444, // Pacific/Tarawa
+    445, // Pacific/Tongatapu
+    446, // Pacific/Wake
+    447, // Pacific/Wallis
+    317, // Etc/GMT
+    318, // Etc/GMT+0
+    319, // Etc/GMT+1
+    323, // Etc/GMT+2
+    324, // Etc/GMT+3
+    325, // Etc/GMT+4
+    326, // Etc/GMT+5
+    327, // Etc/GMT+6
+    328, // Etc/GMT+7
+    329, // Etc/GMT+8
+    330, // Etc/GMT+9
+    320, // Etc/GMT+10
+    321, // Etc/GMT+11
+    322, // Etc/GMT+12
+    331, // Etc/GMT-13
+    332, // Etc/GMT-14
+    333, // Etc/GMT0
+    335, // Etc/UCT
+    336, // Etc/UTC
+    334, // Etc/Greenwich
+    337, // Etc/Universal
+    338, // Etc/Zulu
+};
 
 } // namespace data
 
-// timezones mapping table
-constexpr const char *timezones[][2] PROGMEM = {
-{ data::Africa_Abidjan, data::GMT0 },
-{ data::Africa_Accra, data::GMT0 },
-{ data::Africa_Addis_Ababa, data::EATm3 },
-{ data::Africa_Algiers, data::CETm1 },
-{ data::Africa_Asmara, data::EATm3 },
-{ data::Africa_Bamako, data::GMT0 },
-{ data::Africa_Bangui, data::WATm1 },
-{ data::Africa_Banjul, data::GMT0 },
-{ data::Africa_Bissau, data::GMT0 },
-{ data::Africa_Blantyre, data::CATm2 },
-{ data::Africa_Brazzaville, data::WATm1 },
-{ data::Africa_Bujumbura, data::CATm2 },
-{ data::Africa_Cairo, data::EETm2 },
-{ data::Africa_Casablanca, data::_p01_m1 },
-{ data::Africa_Ceuta, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Africa_Conakry, data::GMT0 },
-{ data::Africa_Dakar, data::GMT0 },
-{ data::Africa_Dar_es_Salaam, data::EATm3 },
-{ data::Africa_Djibouti, data::EATm3 },
-{ data::Africa_Douala, data::WATm1 },
-{ data::Africa_El_Aaiun, data::_p01_m1 },
-{ data::Africa_Freetown, data::GMT0 },
-{ data::Africa_Gaborone, data::CATm2 },
-{ data::Africa_Harare, data::CATm2 },
-{ data::Africa_Johannesburg, data::SASTm2 },
-{ data::Africa_Juba, data::CATm2 },
-{ data::Africa_Kampala, data::EATm3 },
-{ data::Africa_Khartoum, data::CATm2 },
-{ data::Africa_Kigali, data::CATm2 },
-{ data::Africa_Kinshasa, data::WATm1 },
-{ data::Africa_Lagos, data::WATm1 },
-{ data::Africa_Libreville, data::WATm1 },
-{ data::Africa_Lome, data::GMT0 },
-{ data::Africa_Luanda, data::WATm1 },
-{ data::Africa_Lubumbashi, data::CATm2 },
-{ data::Africa_Lusaka, data::CATm2 },
-{ data::Africa_Malabo, data::WATm1 },
-{ data::Africa_Maputo, data::CATm2 },
-{ data::Africa_Maseru, data::SASTm2 },
-{ data::Africa_Mbabane, data::SASTm2 },
-{ data::Africa_Mogadishu, data::EATm3 },
-{ data::Africa_Monrovia, data::GMT0 },
-{ data::Africa_Nairobi, data::EATm3 },
-{ data::Africa_Ndjamena, data::WATm1 },
-{ data::Africa_Niamey, data::WATm1 },
-{ data::Africa_Nouakchott, data::GMT0 },
-{ data::Africa_Ouagadougou, data::GMT0 },
-{ data::Africa_Porto_Novo, data::WATm1 },
-{ data::Africa_Sao_Tome, data::GMT0 },
-{ data::Africa_Tripoli, data::EETm2 },
-{ data::Africa_Tunis, data::CETm1 },
-{ data::Africa_Windhoek, data::CATm2 },
-{ data::America_Adak, data::HST10HDT_M3_2_0_M11_1_0 },
-{ data::America_Anchorage, data::AKST9AKDT_M3_2_0_M11_1_0 },
-{ data::America_Anguilla, data::AST4 },
-{ data::America_Antigua, data::AST4 },
-{ data::America_Araguaina, data::_m03_3 },
-{ data::America_Argentina_Buenos_Aires, data::_m03_3 },
-{ data::America_Argentina_Catamarca, data::_m03_3 },
-{ data::America_Argentina_Cordoba, data::_m03_3 },
-{ data::America_Argentina_Jujuy, data::_m03_3 },
-{ data::America_Argentina_La_Rioja, data::_m03_3 },
-{ data::America_Argentina_Mendoza, data::_m03_3 },
-{ data::America_Argentina_Rio_Gallegos, data::_m03_3 },
-{ data::America_Argentina_Salta, data::_m03_3 },
-{ data::America_Argentina_San_Juan, data::_m03_3 },
-{ data::America_Argentina_San_Luis, data::_m03_3 },
-{ data::America_Argentina_Tucuman, data::_m03_3 },
-{ data::America_Argentina_Ushuaia, data::_m03_3 },
-{ data::America_Aruba, data::AST4 },
-{ data::America_Asuncion, data::_m04_4_m03__M10_1_0_0_M3_4_0_0 },
-{ data::America_Atikokan, data::EST5 },
-{ data::America_Bahia, data::_m03_3 },
-{ data::America_Bahia_Banderas, data::CST6CDT_M4_1_0_M10_5_0 },
-{ data::America_Barbados, data::AST4 },
-{ data::America_Belem, data::_m03_3 },
-{ data::America_Belize, data::CST6 },
-{ data::America_Blanc_Sablon, data::AST4 },
-{ data::America_Boa_Vista, data::_m04_4 },
-{ data::America_Bogota, data::_m05_5 },
-{ data::America_Boise, data::MST7MDT_M3_2_0_M11_1_0 },
-{ data::America_Cambridge_Bay, data::MST7MDT_M3_2_0_M11_1_0 },
-{ data::America_Campo_Grande, data::_m04_4 },
-{ data::America_Cancun, data::EST5 },
-{ data::America_Caracas, data::_m04_4 },
-{ data::America_Cayenne, data::_m03_3 },
-{ data::America_Cayman, data::EST5 },
-{ data::America_Chicago, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Chihuahua, data::MST7MDT_M4_1_0_M10_5_0 },
-{ data::America_Costa_Rica, data::CST6 },
-{ data::America_Creston, data::MST7 },
-{ data::America_Cuiaba, data::_m04_4 },
-{ data::America_Curacao, data::AST4 },
-{ data::America_Danmarkshavn, data::GMT0 },
-{ data::America_Dawson, data::MST7 },
-{ data::America_Dawson_Creek, data::MST7 },
-{ data::America_Denver, data::MST7MDT_M3_2_0_M11_1_0 },
-{ data::America_Detroit, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Dominica, data::AST4 },
-{ data::America_Edmonton, data::MST7MDT_M3_2_0_M11_1_0 },
-{ data::America_Eirunepe, data::_m05_5 },
-{ data::America_El_Salvador, data::CST6 },
-{ data::America_Fortaleza, data::_m03_3 },
-{ data::America_Fort_Nelson, data::MST7 },
-{ data::America_Glace_Bay, data::AST4ADT_M3_2_0_M11_1_0 },
-{ data::America_Godthab, data::_m03_3_m02__M3_5_0_m2_M10_5_0_m1 },
-{ data::America_Goose_Bay, data::AST4ADT_M3_2_0_M11_1_0 },
-{ data::America_Grand_Turk, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Grenada, data::AST4 },
-{ data::America_Guadeloupe, data::AST4 },
-{ data::America_Guatemala, data::CST6 },
-{ data::America_Guayaquil, data::_m05_5 },
-{ data::America_Guyana, data::_m04_4 },
-{ data::America_Halifax, data::AST4ADT_M3_2_0_M11_1_0 },
-{ data::America_Havana, data::CST5CDT_M3_2_0_0_M11_1_0_1 },
-{ data::America_Hermosillo, data::MST7 },
-{ data::America_Indiana_Indianapolis, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Indiana_Knox, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Indiana_Marengo, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Indiana_Petersburg, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Indiana_Tell_City, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Indiana_Vevay, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Indiana_Vincennes, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Indiana_Winamac, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Inuvik, data::MST7MDT_M3_2_0_M11_1_0 },
-{ data::America_Iqaluit, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Jamaica, data::EST5 },
-{ data::America_Juneau, data::AKST9AKDT_M3_2_0_M11_1_0 },
-{ data::America_Kentucky_Louisville, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Kentucky_Monticello, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Kralendijk, data::AST4 },
-{ data::America_La_Paz, data::_m04_4 },
-{ data::America_Lima, data::_m05_5 },
-{ data::America_Los_Angeles, data::PST8PDT_M3_2_0_M11_1_0 },
-{ data::America_Lower_Princes, data::AST4 },
-{ data::America_Maceio, data::_m03_3 },
-{ data::America_Managua, data::CST6 },
-{ data::America_Manaus, data::_m04_4 },
-{ data::America_Marigot, data::AST4 },
-{ data::America_Martinique, data::AST4 },
-{ data::America_Matamoros, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Mazatlan, data::MST7MDT_M4_1_0_M10_5_0 },
-{ data::America_Menominee, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Merida, data::CST6CDT_M4_1_0_M10_5_0 },
-{ data::America_Metlakatla, data::AKST9AKDT_M3_2_0_M11_1_0 },
-{ data::America_Mexico_City, data::CST6CDT_M4_1_0_M10_5_0 },
-{ data::America_Miquelon, data::_m03_3_m02__M3_2_0_M11_1_0 },
-{ data::America_Moncton, data::AST4ADT_M3_2_0_M11_1_0 },
-{ data::America_Monterrey, data::CST6CDT_M4_1_0_M10_5_0 },
-{ data::America_Montevideo, data::_m03_3 },
-{ data::America_Montreal, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Montserrat, data::AST4 },
-{ data::America_Nassau, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_New_York, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Nipigon, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Nome, data::AKST9AKDT_M3_2_0_M11_1_0 },
-{ data::America_Noronha, data::_m02_2 },
-{ data::America_North_Dakota_Beulah, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_North_Dakota_Center, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_North_Dakota_New_Salem, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Nuuk, data::_m03_3_m02__M3_5_0_m2_M10_5_0_m1 },
-{ data::America_Ojinaga, data::MST7MDT_M3_2_0_M11_1_0 },
-{ data::America_Panama, data::EST5 },
-{ data::America_Pangnirtung, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Paramaribo, data::_m03_3 },
-{ data::America_Phoenix, data::MST7 },
-{ data::America_Port_au_Prince, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Port_of_Spain, data::AST4 },
-{ data::America_Porto_Velho, data::_m04_4 },
-{ data::America_Puerto_Rico, data::AST4 },
-{ data::America_Punta_Arenas, data::_m03_3 },
-{ data::America_Rainy_River, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Rankin_Inlet, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Recife, data::_m03_3 },
-{ data::America_Regina, data::CST6 },
-{ data::America_Resolute, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Rio_Branco, data::_m05_5 },
-{ data::America_Santarem, data::_m03_3 },
-{ data::America_Santiago, data::_m04_4_m03__M9_1_6_24_M4_1_6_24 },
-{ data::America_Santo_Domingo, data::AST4 },
-{ data::America_Sao_Paulo, data::_m03_3 },
-{ data::America_Scoresbysund, data::_m01_1_p00__M3_5_0_0_M10_5_0_1 },
-{ data::America_Sitka, data::AKST9AKDT_M3_2_0_M11_1_0 },
-{ data::America_St_Barthelemy, data::AST4 },
-{ data::America_St_Johns, data::NST3_30NDT_M3_2_0_M11_1_0 },
-{ data::America_St_Kitts, data::AST4 },
-{ data::America_St_Lucia, data::AST4 },
-{ data::America_St_Thomas, data::AST4 },
-{ data::America_St_Vincent, data::AST4 },
-{ data::America_Swift_Current, data::CST6 },
-{ data::America_Tegucigalpa, data::CST6 },
-{ data::America_Thule, data::AST4ADT_M3_2_0_M11_1_0 },
-{ data::America_Thunder_Bay, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Tijuana, data::PST8PDT_M3_2_0_M11_1_0 },
-{ data::America_Toronto, data::EST5EDT_M3_2_0_M11_1_0 },
-{ data::America_Tortola, data::AST4 },
-{ data::America_Vancouver, data::PST8PDT_M3_2_0_M11_1_0 },
-{ data::America_Whitehorse, data::MST7 },
-{ data::America_Winnipeg, data::CST6CDT_M3_2_0_M11_1_0 },
-{ data::America_Yakutat, data::AKST9AKDT_M3_2_0_M11_1_0 },
-{ data::America_Yellowknife, data::MST7MDT_M3_2_0_M11_1_0 },
-{ data::Antarctica_Casey, data::_p11_m11 },
-{ data::Antarctica_Davis, data::_p07_m7 },
-{ data::Antarctica_DumontDUrville, data::_p10_m10 },
-{ data::Antarctica_Macquarie, data::AESTm10AEDT_M10_1_0_M4_1_0_3 },
-{ data::Antarctica_Mawson, data::_p05_m5 },
-{ data::Antarctica_McMurdo, data::NZSTm12NZDT_M9_5_0_M4_1_0_3 },
-{ data::Antarctica_Palmer, data::_m03_3 },
-{ data::Antarctica_Rothera, data::_m03_3 },
-{ data::Antarctica_Syowa, data::_p03_m3 },
-{ data::Antarctica_Troll, data::_p00_0_p02_m2_M3_5_0_1_M10_5_0_3 },
-{ data::Antarctica_Vostok, data::_p06_m6 },
-{ data::Arctic_Longyearbyen, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Asia_Aden, data::_p03_m3 },
-{ data::Asia_Almaty, data::_p06_m6 },
-{ data::Asia_Amman, data::EETm2EEST_M2_5_4_24_M10_5_5_1 },
-{ data::Asia_Anadyr, data::_p12_m12 },
-{ data::Asia_Aqtau, data::_p05_m5 },
-{ data::Asia_Aqtobe, data::_p05_m5 },
-{ data::Asia_Ashgabat, data::_p05_m5 },
-{ data::Asia_Atyrau, data::_p05_m5 },
-{ data::Asia_Baghdad, data::_p03_m3 },
-{ data::Asia_Bahrain, data::_p03_m3 },
-{ data::Asia_Baku, data::_p04_m4 },
-{ data::Asia_Bangkok, data::_p07_m7 },
-{ data::Asia_Barnaul, data::_p07_m7 },
-{ data::Asia_Beirut, data::EETm2EEST_M3_5_0_0_M10_5_0_0 },
-{ data::Asia_Bishkek, data::_p06_m6 },
-{ data::Asia_Brunei, data::_p08_m8 },
-{ data::Asia_Chita, data::_p09_m9 },
-{ data::Asia_Choibalsan, data::_p08_m8 },
-{ data::Asia_Colombo, data::_p0530_m5_30 },
-{ data::Asia_Damascus, data::EETm2EEST_M3_5_5_0_M10_5_5_0 },
-{ data::Asia_Dhaka, data::_p06_m6 },
-{ data::Asia_Dili, data::_p09_m9 },
-{ data::Asia_Dubai, data::_p04_m4 },
-{ data::Asia_Dushanbe, data::_p05_m5 },
-{ data::Asia_Famagusta, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Asia_Gaza, data::EETm2EEST_M3_4_4_48_M10_5_5_1 },
-{ data::Asia_Hebron, data::EETm2EEST_M3_4_4_48_M10_5_5_1 },
-{ data::Asia_Ho_Chi_Minh, data::_p07_m7 },
-{ data::Asia_Hong_Kong, data::HKTm8 },
-{ data::Asia_Hovd, data::_p07_m7 },
-{ data::Asia_Irkutsk, data::_p08_m8 },
-{ data::Asia_Jakarta, data::WIBm7 },
-{ data::Asia_Jayapura, data::WITm9 },
-{ data::Asia_Jerusalem, data::ISTm2IDT_M3_4_4_26_M10_5_0 },
-{ data::Asia_Kabul, data::_p0430_m4_30 },
-{ data::Asia_Kamchatka, data::_p12_m12 },
-{ data::Asia_Karachi, data::PKTm5 },
-{ data::Asia_Kathmandu, data::_p0545_m5_45 },
-{ data::Asia_Khandyga, data::_p09_m9 },
-{ data::Asia_Kolkata, data::ISTm5_30 },
-{ data::Asia_Krasnoyarsk, data::_p07_m7 },
-{ data::Asia_Kuala_Lumpur, data::_p08_m8 },
-{ data::Asia_Kuching, data::_p08_m8 },
-{ data::Asia_Kuwait, data::_p03_m3 },
-{ data::Asia_Macau, data::CSTm8 },
-{ data::Asia_Magadan, data::_p11_m11 },
-{ data::Asia_Makassar, data::WITAm8 },
-{ data::Asia_Manila, data::PSTm8 },
-{ data::Asia_Muscat, data::_p04_m4 },
-{ data::Asia_Nicosia, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Asia_Novokuznetsk, data::_p07_m7 },
-{ data::Asia_Novosibirsk, data::_p07_m7 },
-{ data::Asia_Omsk, data::_p06_m6 },
-{ data::Asia_Oral, data::_p05_m5 },
-{ data::Asia_Phnom_Penh, data::_p07_m7 },
-{ data::Asia_Pontianak, data::WIBm7 },
-{ data::Asia_Pyongyang, data::KSTm9 },
-{ data::Asia_Qatar, data::_p03_m3 },
-{ data::Asia_Qyzylorda, data::_p05_m5 },
-{ data::Asia_Riyadh, data::_p03_m3 },
-{ data::Asia_Sakhalin, data::_p11_m11 },
-{ data::Asia_Samarkand, data::_p05_m5 },
-{ data::Asia_Seoul, data::KSTm9 },
-{ data::Asia_Shanghai, data::CSTm8 },
-{ data::Asia_Singapore, data::_p08_m8 },
-{ data::Asia_Srednekolymsk, data::_p11_m11 },
-{ data::Asia_Taipei, data::CSTm8 },
-{ data::Asia_Tashkent, data::_p05_m5 },
-{ data::Asia_Tbilisi, data::_p04_m4 },
-{ data::Asia_Tehran, data::_p0330_m3_30_p0430__J79_24_J263_24 },
-{ data::Asia_Thimphu, data::_p06_m6 },
-{ data::Asia_Tokyo, data::JSTm9 },
-{ data::Asia_Tomsk, data::_p07_m7 },
-{ data::Asia_Ulaanbaatar, data::_p08_m8 },
-{ data::Asia_Urumqi, data::_p06_m6 },
-{ data::Asia_Ust_Nera, data::_p10_m10 },
-{ data::Asia_Vientiane, data::_p07_m7 },
-{ data::Asia_Vladivostok, data::_p10_m10 },
-{ data::Asia_Yakutsk, data::_p09_m9 },
-{ data::Asia_Yangon, data::_p0630_m6_30 },
-{ data::Asia_Yekaterinburg, data::_p05_m5 },
-{ data::Asia_Yerevan, data::_p04_m4 },
-{ data::Atlantic_Azores, data::_m01_1_p00__M3_5_0_0_M10_5_0_1 },
-{ data::Atlantic_Bermuda, data::AST4ADT_M3_2_0_M11_1_0 },
-{ data::Atlantic_Canary, data::WET0WEST_M3_5_0_1_M10_5_0 },
-{ data::Atlantic_Cape_Verde, data::_m01_1 },
-{ data::Atlantic_Faroe, data::WET0WEST_M3_5_0_1_M10_5_0 },
-{ data::Atlantic_Madeira, data::WET0WEST_M3_5_0_1_M10_5_0 },
-{ data::Atlantic_Reykjavik, data::GMT0 },
-{ data::Atlantic_South_Georgia, data::_m02_2 },
-{ data::Atlantic_Stanley, data::_m03_3 },
-{ data::Atlantic_St_Helena, data::GMT0 },
-{ data::Australia_Adelaide, data::ACSTm9_30ACDT_M10_1_0_M4_1_0_3 },
-{ data::Australia_Brisbane, data::AESTm10 },
-{ data::Australia_Broken_Hill, data::ACSTm9_30ACDT_M10_1_0_M4_1_0_3 },
-{ data::Australia_Currie, data::AESTm10AEDT_M10_1_0_M4_1_0_3 },
-{ data::Australia_Darwin, data::ACSTm9_30 },
-{ data::Australia_Eucla, data::_p0845_m8_45 },
-{ data::Australia_Hobart, data::AESTm10AEDT_M10_1_0_M4_1_0_3 },
-{ data::Australia_Lindeman, data::AESTm10 },
-{ data::Australia_Lord_Howe, data::_p1030_m10_30_p11_m11_M10_1_0_M4_1_0 },
-{ data::Australia_Melbourne, data::AESTm10AEDT_M10_1_0_M4_1_0_3 },
-{ data::Australia_Perth, data::AWSTm8 },
-{ data::Australia_Sydney, data::AESTm10AEDT_M10_1_0_M4_1_0_3 },
-{ data::Europe_Amsterdam, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Andorra, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Astrakhan, data::_p04_m4 },
-{ data::Europe_Athens, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Belgrade, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Berlin, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Bratislava, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Brussels, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Bucharest, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Budapest, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Busingen, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Chisinau, data::EETm2EEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Copenhagen, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Dublin, data::ISTm1GMT0_M10_5_0_M3_5_0_1 },
-{ data::Europe_Gibraltar, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Guernsey, data::GMT0BST_M3_5_0_1_M10_5_0 },
-{ data::Europe_Helsinki, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Isle_of_Man, data::GMT0BST_M3_5_0_1_M10_5_0 },
-{ data::Europe_Istanbul, data::_p03_m3 },
-{ data::Europe_Jersey, data::GMT0BST_M3_5_0_1_M10_5_0 },
-{ data::Europe_Kaliningrad, data::EETm2 },
-{ data::Europe_Kiev, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Kirov, data::_p03_m3 },
-{ data::Europe_Lisbon, data::WET0WEST_M3_5_0_1_M10_5_0 },
-{ data::Europe_Ljubljana, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_London, data::GMT0BST_M3_5_0_1_M10_5_0 },
-{ data::Europe_Luxembourg, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Madrid, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Malta, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Mariehamn, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Minsk, data::_p03_m3 },
-{ data::Europe_Monaco, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Moscow, data::MSKm3 },
-{ data::Europe_Oslo, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Paris, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Podgorica, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Prague, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Riga, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Rome, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Samara, data::_p04_m4 },
-{ data::Europe_San_Marino, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Sarajevo, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Saratov, data::_p04_m4 },
-{ data::Europe_Simferopol, data::MSKm3 },
-{ data::Europe_Skopje, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Sofia, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Stockholm, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Tallinn, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Tirane, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Ulyanovsk, data::_p04_m4 },
-{ data::Europe_Uzhgorod, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Vaduz, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Vatican, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Vienna, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Vilnius, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Volgograd, data::_p03_m3 },
-{ data::Europe_Warsaw, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Zagreb, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Europe_Zaporozhye, data::EETm2EEST_M3_5_0_3_M10_5_0_4 },
-{ data::Europe_Zurich, data::CETm1CEST_M3_5_0_M10_5_0_3 },
-{ data::Indian_Antananarivo, data::EATm3 },
-{ data::Indian_Chagos, data::_p06_m6 },
-{ data::Indian_Christmas, data::_p07_m7 },
-{ data::Indian_Cocos, data::_p0630_m6_30 },
-{ data::Indian_Comoro, data::EATm3 },
-{ data::Indian_Kerguelen, data::_p05_m5 },
-{ data::Indian_Mahe, data::_p04_m4 },
-{ data::Indian_Maldives, data::_p05_m5 },
-{ data::Indian_Mauritius, data::_p04_m4 },
-{ data::Indian_Mayotte, data::EATm3 },
-{ data::Indian_Reunion, data::_p04_m4 },
-{ data::Pacific_Apia, data::_p13_m13 },
-{ data::Pacific_Auckland, data::NZSTm12NZDT_M9_5_0_M4_1_0_3 },
-{ data::Pacific_Bougainville, data::_p11_m11 },
-{ data::Pacific_Chatham, data::_p1245_m12_45_p1345__M9_5_0_2_45_M4_1_0_3_45 },
-{ data::Pacific_Chuuk, data::_p10_m10 },
-{ data::Pacific_Easter, data::_m06_6_m05__M9_1_6_22_M4_1_6_22 },
-{ data::Pacific_Efate, data::_p11_m11 },
-{ data::Pacific_Enderbury, data::_p13_m13 },
-{ data::Pacific_Fakaofo, data::_p13_m13 },
-{ data::Pacific_Fiji, data::_p12_m12_p13__M11_2_0_M1_2_3_99 },
-{ data::Pacific_Funafuti, data::_p12_m12 },
-{ data::Pacific_Galapagos, data::_m06_6 },
-{ data::Pacific_Gambier, data::_m09_9 },
-{ data::Pacific_Guadalcanal, data::_p11_m11 },
-{ data::Pacific_Guam, data::ChSTm10 },
-{ data::Pacific_Honolulu, data::HST10 },
-{ data::Pacific_Kiritimati, data::_p14_m14 },
-{ data::Pacific_Kosrae, data::_p11_m11 },
-{ data::Pacific_Kwajalein, data::_p12_m12 },
-{ data::Pacific_Majuro, data::_p12_m12 },
-{ data::Pacific_Marquesas, data::_m0930_9_30 },
-{ data::Pacific_Midway, data::SST11 },
-{ data::Pacific_Nauru, data::_p12_m12 },
-{ data::Pacific_Niue, data::_m11_11 },
-{ data::Pacific_Norfolk, data::_p11_m11_p12__M10_1_0_M4_1_0_3 },
-{ data::Pacific_Noumea, data::_p11_m11 },
-{ data::Pacific_Pago_Pago, data::SST11 },
-{ data::Pacific_Palau, data::_p09_m9 },
-{ data::Pacific_Pitcairn, data::_m08_8 },
-{ data::Pacific_Pohnpei, data::_p11_m11 },
-{ data::Pacific_Port_Moresby, data::_p10_m10 },
-{ data::Pacific_Rarotonga, data::_m10_10 },
-{ data::Pacific_Saipan, data::ChSTm10 },
-{ data::Pacific_Tahiti, data::_m10_10 },
-{ data::Pacific_Tarawa, data::_p12_m12 },
-{ data::Pacific_Tongatapu, data::_p13_m13 },
-{ data::Pacific_Wake, data::_p12_m12 },
-{ data::Pacific_Wallis, data::_p12_m12 },
-{ data::Etc_GMT, data::GMT0 },
-{ data::Etc_GMT_0, data::GMT0 },
-{ data::Etc_GMT_1, data::_m01_1 },
-{ data::Etc_GMT_2, data::_m02_2 },
-{ data::Etc_GMT_3, data::_m03_3 },
-{ data::Etc_GMT_4, data::_m04_4 },
-{ data::Etc_GMT_5, data::_m05_5 },
-{ data::Etc_GMT_6, data::_m06_6 },
-{ data::Etc_GMT_7, data::_m07_7 },
-{ data::Etc_GMT_8, data::_m08_8 },
-{ data::Etc_GMT_9, data::_m09_9 },
-{ data::Etc_GMT_10, data::_m10_10 },
-{ data::Etc_GMT_11, data::_m11_11 },
-{ data::Etc_GMT_12, data::_m12_12 },
-{ data::Etc_GMT_13, data::_p13_m13 },
-{ data::Etc_GMT_14, data::_p14_m14 },
-{ data::Etc_GMT0, data::GMT0 },
-{ data::Etc_UCT, data::UTC0 },
-{ data::Etc_UTC, data::UTC0 },
-{ data::Etc_Greenwich, data::GMT0 },
-{ data::Etc_Universal, data::UTC0 },
-{ data::Etc_Zulu, data::UTC0 },
-};
 constexpr size_t timezoneSize = 448;
+constexpr size_t timezoneLegacySize = 448;
+
+// index of an IANA name, timezoneSize if it is unknown
+// for compile time constants only, at run time the pool has to be read with the _P functions (see findTimezone())
+constexpr size_t timezoneIndex(std::string_view name) {
+    size_t lo = 0;
+    size_t hi = timezoneSize;
+    while(lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        const std::string_view entry(data::timezonePool + data::timezoneTable[mid].name);
+        if(entry == name)
+            return mid;
+        if(entry < name)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return timezoneSize;
+}
+
+// binary search in flash, timezoneSize if the name is unknown
+inline size_t findTimezone(const char *name) {
+    size_t lo = 0;
+    size_t hi = timezoneSize;
+    while(lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        const int cmp = strcmp_P(name, data::timezonePool + pgm_read_word(&data::timezoneTable[mid].name));
+        if(cmp == 0)
+            return mid;
+        if(cmp > 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return timezoneSize;
+}
 
-//timezone enum
-enum TZ_Names : size_t {
-TZ_Africa_Abidjan = 0,
-TZ_Africa_Accra,
-TZ_Africa_Addis_Ababa,
-TZ_Africa_Algiers,
-TZ_Africa_Asmara,
-TZ_Africa_Bamako,
-TZ_Africa_Bangui,
-TZ_Africa_Banjul,
-TZ_Africa_Bissau,
-TZ_Africa_Blantyre,
-TZ_Africa_Brazzaville,
-TZ_Africa_Bujumbura,
-TZ_Africa_Cairo,
-TZ_Africa_Casablanca,
-TZ_Africa_Ceuta,
-TZ_Africa_Conakry,
-TZ_Africa_Dakar,
-TZ_Africa_Dar_es_Salaam,
-TZ_Africa_Djibouti,
-TZ_Africa_Douala,
-TZ_Africa_El_Aaiun,
-TZ_Africa_Freetown,
-TZ_Africa_Gaborone,
-TZ_Africa_Harare,
-TZ_Africa_Johannesburg,
-TZ_Africa_Juba,
-TZ_Africa_Kampala,
-TZ_Africa_Khartoum,
-TZ_Africa_Kigali,
-TZ_Africa_Kinshasa,
-TZ_Africa_Lagos,
-TZ_Africa_Libreville,
-TZ_Africa_Lome,
-TZ_Africa_Luanda,
-TZ_Africa_Lubumbashi,
-TZ_Africa_Lusaka,
-TZ_Africa_Malabo,
-TZ_Africa_Maputo,
-TZ_Africa_Maseru,
-TZ_Africa_Mbabane,
-TZ_Africa_Mogadishu,
-TZ_Africa_Monrovia,
-TZ_Africa_Nairobi,
-TZ_Africa_Ndjamena,
-TZ_Africa_Niamey,
-TZ_Africa_Nouakchott,
-TZ_Africa_Ouagadougou,
-TZ_Africa_Porto_Novo,
-TZ_Africa_Sao_Tome,
-TZ_Africa_Tripoli,
-TZ_Africa_Tunis,
-TZ_Africa_Windhoek,
-TZ_America_Adak,
-TZ_America_Anchorage,
-TZ_America_Anguilla,
-TZ_America_Antigua,
-TZ_America_Araguaina,
-TZ_America_Argentina_Buenos_Aires,
-TZ_America_Argentina_Catamarca,
-TZ_America_Argentina_Cordoba,
-TZ_America_Argentina_Jujuy,
-TZ_America_Argentina_La_Rioja,
-TZ_America_Argentina_Mendoza,
-TZ_America_Argentina_Rio_Gallegos,
-TZ_America_Argentina_Salta,
-TZ_America_Argentina_San_Juan,
-TZ_America_Argentina_San_Luis,
-TZ_America_Argentina_Tucuman,
-TZ_America_Argentina_Ushuaia,
-TZ_America_Aruba,
-TZ_America_Asuncion,
-TZ_America_Atikokan,
-TZ_America_Bahia,
-TZ_America_Bahia_Banderas,
-TZ_America_Barbados,
-TZ_America_Belem,
-TZ_America_Belize,
-TZ_America_Blanc_Sablon,
-TZ_America_Boa_Vista,
-TZ_America_Bogota,
-TZ_America_Boise,
-TZ_America_Cambridge_Bay,
-TZ_America_Campo_Grande,
-TZ_America_Cancun,
-TZ_America_Caracas,
-TZ_America_Cayenne,
-TZ_America_Cayman,
-TZ_America_Chicago,
-TZ_America_Chihuahua,
-TZ_America_Costa_Rica,
-TZ_America_Creston,
-TZ_America_Cuiaba,
-TZ_America_Curacao,
-TZ_America_Danmarkshavn,
-TZ_America_Dawson,
-TZ_America_Dawson_Creek,
-TZ_America_Denver,
-TZ_America_Detroit,
-TZ_America_Dominica,
-TZ_America_Edmonton,
-TZ_America_Eirunepe,
-TZ_America_El_Salvador,
-TZ_America_Fortaleza,
-TZ_America_Fort_Nelson,
-TZ_America_Glace_Bay,
-TZ_America_Godthab,
-TZ_America_Goose_Bay,
-TZ_America_Grand_Turk,
-TZ_America_Grenada,
-TZ_America_Guadeloupe,
-TZ_America_Guatemala,
-TZ_America_Guayaquil,
-TZ_America_Guyana,
-TZ_America_Halifax,
-TZ_America_Havana,
-TZ_America_Hermosillo,
-TZ_America_Indiana_Indianapolis,
-TZ_America_Indiana_Knox,
-TZ_America_Indiana_Marengo,
-TZ_America_Indiana_Petersburg,
-TZ_America_Indiana_Tell_City,
-TZ_America_Indiana_Vevay,
-TZ_America_Indiana_Vincennes,
-TZ_America_Indiana_Winamac,
-TZ_America_Inuvik,
-TZ_America_Iqaluit,
-TZ_America_Jamaica,
-TZ_America_Juneau,
-TZ_America_Kentucky_Louisville,
-TZ_America_Kentucky_Monticello,
-TZ_America_Kralendijk,
-TZ_America_La_Paz,
-TZ_America_Lima,
-TZ_America_Los_Angeles,
-TZ_America_Lower_Princes,
-TZ_America_Maceio,
-TZ_America_Managua,
-TZ_America_Manaus,
-TZ_America_Marigot,
-TZ_America_Martinique,
-TZ_America_Matamoros,
-TZ_America_Mazatlan,
-TZ_America_Menominee,
-TZ_America_Merida,
-TZ_America_Metlakatla,
-TZ_America_Mexico_City,
-TZ_America_Miquelon,
-TZ_America_Moncton,
-TZ_America_Monterrey,
-TZ_America_Montevideo,
-TZ_America_Montreal,
-TZ_America_Montserrat,
-TZ_America_Nassau,
-TZ_America_New_York,
-TZ_America_Nipigon,
-TZ_America_Nome,
-TZ_America_Noronha,
-TZ_America_North_Dakota_Beulah,
-TZ_America_North_Dakota_Center,
-TZ_America_North_Dakota_New_Salem,
-TZ_America_Nuuk,
-TZ_America_Ojinaga,
-TZ_America_Panama,
-TZ_America_Pangnirtung,
-TZ_America_Paramaribo,
-TZ_America_Phoenix,
-TZ_America_Port_au_Prince,
-TZ_America_Port_of_Spain,
-TZ_America_Porto_Velho,
-TZ_America_Puerto_Rico,
-TZ_America_Punta_Arenas,
-TZ_America_Rainy_River,
-TZ_America_Rankin_Inlet,
-TZ_America_Recife,
-TZ_America_Regina,
-TZ_America_Resolute,
-TZ_America_Rio_Branco,
-TZ_America_Santarem,
-TZ_America_Santiago,
-TZ_America_Santo_Domingo,
-TZ_America_Sao_Paulo,
-TZ_America_Scoresbysund,
-TZ_America_Sitka,
-TZ_America_St_Barthelemy,
-TZ_America_St_Johns,
-TZ_America_St_Kitts,
-TZ_America_St_Lucia,
-TZ_America_St_Thomas,
-TZ_America_St_Vincent,
-TZ_America_Swift_Current,
-TZ_America_Tegucigalpa,
-TZ_America_Thule,
-TZ_America_Thunder_Bay,
-TZ_America_Tijuana,
-TZ_America_Toronto,
-TZ_America_Tortola,
-TZ_America_Vancouver,
-TZ_America_Whitehorse,
-TZ_America_Winnipeg,
-TZ_America_Yakutat,
-TZ_America_Yellowknife,
-TZ_Antarctica_Casey,
-TZ_Antarctica_Davis,
-TZ_Antarctica_DumontDUrville,
-TZ_Antarctica_Macquarie,
-TZ_Antarctica_Mawson,
-TZ_Antarctica_McMurdo,
-TZ_Antarctica_Palmer,
-TZ_Antarctica_Rothera,
-TZ_Antarctica_Syowa,
-TZ_Antarctica_Troll,
-TZ_Antarctica_Vostok,
-TZ_Arctic_Longyearbyen,
-TZ_Asia_Aden,
-TZ_Asia_Almaty,
-TZ_Asia_Amman,
-TZ_Asia_Anadyr,
-TZ_Asia_Aqtau,
-TZ_Asia_Aqtobe,
-TZ_Asia_Ashgabat,
-TZ_Asia_Atyrau,
-TZ_Asia_Baghdad,
-TZ_Asia_Bahrain,
-TZ_Asia_Baku,
-TZ_Asia_Bangkok,
-TZ_Asia_Barnaul,
-TZ_Asia_Beirut,
-TZ_Asia_Bishkek,
-TZ_Asia_Brunei,
-TZ_Asia_Chita,
-TZ_Asia_Choibalsan,
-TZ_Asia_Colombo,
-TZ_Asia_Damascus,
-TZ_Asia_Dhaka,
-TZ_Asia_Dili,
-TZ_Asia_Dubai,
-TZ_Asia_Dushanbe,
-TZ_Asia_Famagusta,
-TZ_Asia_Gaza,
-TZ_Asia_Hebron,
-TZ_Asia_Ho_Chi_Minh,
-TZ_Asia_Hong_Kong,
-TZ_Asia_Hovd,
-TZ_Asia_Irkutsk,
-TZ_Asia_Jakarta,
-TZ_Asia_Jayapura,
-TZ_Asia_Jerusalem,
-TZ_Asia_Kabul,
-TZ_Asia_Kamchatka,
-TZ_Asia_Karachi,
-TZ_Asia_Kathmandu,
-TZ_Asia_Khandyga,
-TZ_Asia_Kolkata,
-TZ_Asia_Krasnoyarsk,
-TZ_Asia_Kuala_Lumpur,
-TZ_Asia_Kuching,
-TZ_Asia_Kuwait,
-TZ_Asia_Macau,
-TZ_Asia_Magadan,
-TZ_Asia_Makassar,
-TZ_Asia_Manila,
-TZ_Asia_Muscat,
-TZ_Asia_Nicosia,
-TZ_Asia_Novokuznetsk,
-TZ_Asia_Novosibirsk,
-TZ_Asia_Omsk,
-TZ_Asia_Oral,
-TZ_Asia_Phnom_Penh,
-TZ_Asia_Pontianak,
-TZ_Asia_Pyongyang,
-TZ_Asia_Qatar,
-TZ_Asia_Qyzylorda,
-TZ_Asia_Riyadh,
-TZ_Asia_Sakhalin,
-TZ_Asia_Samarkand,
-TZ_Asia_Seoul,
-TZ_Asia_Shanghai,
-TZ_Asia_Singapore,
-TZ_Asia_Srednekolymsk,
-TZ_Asia_Taipei,
-TZ_Asia_Tashkent,
-TZ_Asia_Tbilisi,
-TZ_Asia_Tehran,
-TZ_Asia_Thimphu,
-TZ_Asia_Tokyo,
-TZ_Asia_Tomsk,
-TZ_Asia_Ulaanbaatar,
-TZ_Asia_Urumqi,
-TZ_Asia_Ust_Nera,
-TZ_Asia_Vientiane,
-TZ_Asia_Vladivostok,
-TZ_Asia_Yakutsk,
-TZ_Asia_Yangon,
-TZ_Asia_Yekaterinburg,
-TZ_Asia_Yerevan,
-TZ_Atlantic_Azores,
-TZ_Atlantic_Bermuda,
-TZ_Atlantic_Canary,
-TZ_Atlantic_Cape_Verde,
-TZ_Atlantic_Faroe,
-TZ_Atlantic_Madeira,
-TZ_Atlantic_Reykjavik,
-TZ_Atlantic_South_Georgia,
-TZ_Atlantic_Stanley,
-TZ_Atlantic_St_Helena,
-TZ_Australia_Adelaide,
-TZ_Australia_Brisbane,
-TZ_Australia_Broken_Hill,
-TZ_Australia_Currie,
-TZ_Australia_Darwin,
-TZ_Australia_Eucla,
-TZ_Australia_Hobart,
-TZ_Australia_Lindeman,
-TZ_Australia_Lord_Howe,
-TZ_Australia_Melbourne,
-TZ_Australia_Perth,
-TZ_Australia_Sydney,
-TZ_Europe_Amsterdam,
-TZ_Europe_Andorra,
-TZ_Europe_Astrakhan,
-TZ_Europe_Athens,
-TZ_Europe_Belgrade,
-TZ_Europe_Berlin,
-TZ_Europe_Bratislava,
-TZ_Europe_Brussels,
-TZ_Europe_Bucharest,
-TZ_Europe_Budapest,
-TZ_Europe_Busingen,
-TZ_Europe_Chisinau,
-TZ_Europe_Copenhagen,
-TZ_Europe_Dublin,
-TZ_Europe_Gibraltar,
-TZ_Europe_Guernsey,
-TZ_Europe_Helsinki,
-TZ_Europe_Isle_of_Man,
-TZ_Europe_Istanbul,
-TZ_Europe_Jersey,
-TZ_Europe_Kaliningrad,
-TZ_Europe_Kiev,
-TZ_Europe_Kirov,
-TZ_Europe_Lisbon,
-TZ_Europe_Ljubljana,
-TZ_Europe_London,
-TZ_Europe_Luxembourg,
-TZ_Europe_Madrid,
-TZ_Europe_Malta,
-TZ_Europe_Mariehamn,
-TZ_Europe_Minsk,
-TZ_Europe_Monaco,
-TZ_Europe_Moscow,
-TZ_Europe_Oslo,
-TZ_Europe_Paris,
-TZ_Europe_Podgorica,
-TZ_Europe_Prague,
-TZ_Europe_Riga,
-TZ_Europe_Rome,
-TZ_Europe_Samara,
-TZ_Europe_San_Marino,
-TZ_Europe_Sarajevo,
-TZ_Europe_Saratov,
-TZ_Europe_Simferopol,
-TZ_Europe_Skopje,
-TZ_Europe_Sofia,
-TZ_Europe_Stockholm,
-TZ_Europe_Tallinn,
-TZ_Europe_Tirane,
-TZ_Europe_Ulyanovsk,
-TZ_Europe_Uzhgorod,
-TZ_Europe_Vaduz,
-TZ_Europe_Vatican,
-TZ_Europe_Vienna,
-TZ_Europe_Vilnius,
-TZ_Europe_Volgograd,
-TZ_Europe_Warsaw,
-TZ_Europe_Zagreb,
-TZ_Europe_Zaporozhye,
-TZ_Europe_Zurich,
-TZ_Indian_Antananarivo,
-TZ_Indian_Chagos,
-TZ_Indian_Christmas,
-TZ_Indian_Cocos,
-TZ_Indian_Comoro,
-TZ_Indian_Kerguelen,
-TZ_Indian_Mahe,
-TZ_Indian_Maldives,
-TZ_Indian_Mauritius,
-TZ_Indian_Mayotte,
-TZ_Indian_Reunion,
-TZ_Pacific_Apia,
-TZ_Pacific_Auckland,
-TZ_Pacific_Bougainville,
-TZ_Pacific_Chatham,
-TZ_Pacific_Chuuk,
-TZ_Pacific_Easter,
-TZ_Pacific_Efate,
-TZ_Pacific_Enderbury,
-TZ_Pacific_Fakaofo,
-TZ_Pacific_Fiji,
-TZ_Pacific_Funafuti,
-TZ_Pacific_Galapagos,
-TZ_Pacific_Gambier,
-TZ_Pacific_Guadalcanal,
-TZ_Pacific_Guam,
-TZ_Pacific_Honolulu,
-TZ_Pacific_Kiritimati,
-TZ_Pacific_Kosrae,
-TZ_Pacific_Kwajalein,
-TZ_Pacific_Majuro,
-TZ_Pacific_Marquesas,
-TZ_Pacific_Midway,
-TZ_Pacific_Nauru,
-TZ_Pacific_Niue,
-TZ_Pacific_Norfolk,
-TZ_Pacific_Noumea,
-TZ_Pacific_Pago_Pago,
-TZ_Pacific_Palau,
-TZ_Pacific_Pitcairn,
-TZ_Pacific_Pohnpei,
-TZ_Pacific_Port_Moresby,
-TZ_Pacific_Rarotonga,
-TZ_Pacific_Saipan,
-TZ_Pacific_Tahiti,
-TZ_Pacific_Tarawa,
-TZ_Pacific_Tongatapu,
-TZ_Pacific_Wake,
-TZ_Pacific_Wallis,
-TZ_Etc_GMT,
-TZ_Etc_GMT_0,
-TZ_Etc_GMT_1,
-TZ_Etc_GMT_2,
-TZ_Etc_GMT_3,
-TZ_Etc_GMT_4,
-TZ_Etc_GMT_5,
-TZ_Etc_GMT_6,
-TZ_Etc_GMT_7,
-TZ_Etc_GMT_8,
-TZ_Etc_GMT_9,
-TZ_Etc_GMT_10,
-TZ_Etc_GMT_11,
-TZ_Etc_GMT_12,
-TZ_Etc_GMT_13,
-TZ_Etc_GMT_14,
-TZ_Etc_GMT0,
-TZ_Etc_UCT,
-TZ_Etc_UTC,
-TZ_Etc_Greenwich,
-TZ_Etc_Universal,
-TZ_Etc_Zulu,
-};
\ No newline at end of file
+inline PGM_P timezoneName(size_t i) { return data::timezonePool + pgm_read_word(&data::timezoneTable[i].name); }
+inline PGM_P timezoneRule(size_t i) { return data::timezonePool + pgm_read_word(&data::timezoneTable[i].rule); }
+inline size_t timezoneFromLegacy(size_t i) { return i < timezoneLegacySize ? pgm_read_word(&data::timezoneLegacyIndex[i]) : timezoneSize; }
@@ -0,0 +1,186 @@
+#pragma once
+/*
+ * autogenerated code by timezone.py
+ */
+
+#include <Arduino.h>
+
+// changes with the content, the page asks for /timezones.json?v=<version> so the browser may cache it forever
+constexpr const char timezonesJsonVersion[] PROGMEM = "81d289e9";
+
+// ["Africa/Abidjan",...] indexed like data::timezoneTable, gzip compressed
+constexpr const uint8_t timezonesJsonGz[] PROGMEM = {
+0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x59, 0xdb, 0x72, 0xdb, 0x38,
+0x12, 0xfd, 0x97, 0x79, 0xdd, 0x4d, 0xcd, 0xee, 0xce, 0x5e, 0x1f, 0x63, 0xd9, 0xb1, 0x63, 0x59,
+0x8a, 0xc6, 0x92, 0x9d, 0xca, 0x6c, 0x6d, 0xb1, 0x9a, 0x24, 0x4c, 0x42, 0x04, 0xd1, 0x32, 0x48,
+0x48, 0xa1, 0xbe, 0x7e, 0x0f, 0x44, 0x91, 0x6c, 0x28, 0xca, 0x8b, 0xcd, 0x3e, 0xb8, 0x35, 0xfa,
+0xde, 0xd0, 0x7f, 0x7f, 0xf9, 0xf8, 0xe6, 0x74, 0x46, 0xbf, 0x7e, 0x4c, 0x75, 0xbe, 0x25, 0xfb,
+0xcb, 0x9f, 0x47, 0x20, 0xcb, 0x1c, 0x09, 0x32, 0xcf, 0x75, 0x93, 0x7c, 0x4c, 0x29, 0x95, 0xa0,
+0x29, 0xb4, 0x72, 0x8d, 0x00, 0x9a, 0x9a, 0xe4, 0xaa, 0x1b, 0xaa, 0xa9, 0x62, 0x49, 0xdb, 0xc2,
+0xeb, 0x88, 0xde, 0x7a, 0x23, 0x68, 0xdd, 0x34, 0xe4, 0x05, 0x6d, 0xc8, 0xb6, 0x9d, 0x53, 0x02,
+0x71, 0x74, 0x3c, 0xd2, 0x5e, 0x1b, 0x23, 0x41, 0xbf, 0xf5, 0x75, 0xea, 0xe5, 0xc9, 0x33, 0xd2,
+0x8e, 0x25, 0xd9, 0x50, 0x8a, 0xcd, 0x32, 0x39, 0x45, 0xf9, 0x56, 0x92, 0x6c, 0xa9, 0x72, 0xdd,
+0x04, 0xdc, 0x52, 0x45, 0x4e, 0x92, 0x2e, 0x51, 0x4d, 0xb2, 0x26, 0x43, 0x54, 0x0b, 0x78, 0xab,
+0x53, 0xf6, 0xad, 0xb8, 0xd4, 0x2d, 0x7b, 0xcc, 0x99, 0xe8, 0x3b, 0x93, 0x7c, 0x24, 0xed, 0x85,
+0x6c, 0x3f, 0x39, 0xa5, 0x5a, 0x3e, 0x08, 0xe4, 0x9e, 0x52, 0x76, 0x6c, 0xc5, 0x9d, 0x1e, 0x20,
+0x48, 0x79, 0xf1, 0x47, 0x2e, 0xc9, 0x5a, 0xd5, 0xe0, 0x9a, 0x85, 0x40, 0xbd, 0xd4, 0xc7, 0x9c,
+0xea, 0x5d, 0x74, 0xf4, 0xbc, 0x24, 0xd7, 0xb2, 0x17, 0xec, 0xce, 0x75, 0x41, 0x46, 0x4b, 0xda,
+0x36, 0x25, 0x84, 0x33, 0x21, 0x4f, 0x54, 0xb0, 0x50, 0xe9, 0x93, 0x4e, 0x9d, 0xba, 0x90, 0xf7,
+0x13, 0xd7, 0x92, 0xf2, 0x64, 0x73, 0xb9, 0x81, 0x4f, 0xa1, 0x0d, 0x6a, 0x4a, 0x2d, 0xb1, 0x06,
+0xd2, 0x9c, 0xe8, 0x05, 0xd8, 0x4c, 0x59, 0xd2, 0x3b, 0xdf, 0x46, 0x74, 0xa3, 0x9c, 0x30, 0x84,
+0x45, 0x30, 0x3c, 0x29, 0x9e, 0x05, 0x17, 0x04, 0x8b, 0x2c, 0xe5, 0x1c, 0xb6, 0x8e, 0xf7, 0x5a,
+0x9c, 0xb2, 0x0c, 0x46, 0x90, 0x0a, 0x36, 0x96, 0xb0, 0xf1, 0x5a, 0x59, 0x39, 0x45, 0x03, 0x10,
+0x4a, 0x5f, 0x42, 0x79, 0x55, 0x56, 0x72, 0xdb, 0x4e, 0xd8, 0x17, 0x4f, 0x38, 0x8c, 0x7d, 0xc1,
+0xe2, 0xb4, 0x15, 0x43, 0xb2, 0x1f, 0x96, 0xbc, 0x17, 0x5c, 0xaf, 0x89, 0x93, 0x4d, 0x24, 0x9b,
+0x8d, 0xd3, 0x3b, 0x96, 0xf2, 0xde, 0x78, 0xab, 0x85, 0x74, 0xbf, 0x6a, 0x9b, 0x97, 0xac, 0xaa,
+0x80, 0xd4, 0xea, 0xec, 0x69, 0x14, 0x91, 0x16, 0xdc, 0x38, 0x2a, 0x54, 0x84, 0xc1, 0x8b, 0x4c,
+0xaf, 0xe8, 0x11, 0x6a, 0x75, 0xe1, 0x23, 0x04, 0x8b, 0x3c, 0x69, 0x1b, 0x63, 0x85, 0xc2, 0x44,
+0x1b, 0x5c, 0x46, 0x59, 0x86, 0x43, 0x6b, 0xa7, 0x9a, 0xab, 0x13, 0x66, 0xd4, 0xc2, 0x79, 0x5d,
+0x76, 0x7d, 0xf9, 0x8c, 0x5d, 0xce, 0xe9, 0xf5, 0xb1, 0x47, 0x78, 0x63, 0x77, 0x75, 0xe4, 0x89,
+0x92, 0x67, 0xcd, 0xdb, 0xeb, 0xcb, 0x16, 0xca, 0xe6, 0x7c, 0xbc, 0x3e, 0x86, 0x55, 0xc9, 0x3d,
+0xc1, 0x06, 0xcf, 0xa6, 0xf9, 0xc3, 0x04, 0x78, 0x65, 0x4b, 0x3f, 0x19, 0xb1, 0xc9, 0xa3, 0xef,
+0x23, 0xdb, 0xd5, 0xc1, 0x27, 0xaf, 0xaf, 0xef, 0xb9, 0xf1, 0x99, 0xaf, 0x7f, 0xb2, 0xf0, 0x05,
+0x96, 0x47, 0x3a, 0x3e, 0xd1, 0xc7, 0xf2, 0x68, 0xbc, 0xcd, 0x34, 0x47, 0xcb, 0x5b, 0x5d, 0x71,
+0x15, 0xed, 0x78, 0x43, 0x65, 0xb4, 0xcb, 0x89, 0x4e, 0x10, 0x16, 0x73, 0xe5, 0xa8, 0x89, 0x06,
+0x5c, 0x0a, 0x1b, 0x8c, 0x20, 0x65, 0x54, 0x1d, 0xd3, 0xfa, 0x28, 0xcd, 0x24, 0x44, 0xcf, 0xec,
+0xc3, 0x1a, 0x81, 0x2f, 0x62, 0xe3, 0x86, 0x29, 0x79, 0xd5, 0x4d, 0x24, 0xaf, 0x1b, 0x2e, 0xf8,
+0x02, 0xd0, 0x8d, 0xdc, 0x6b, 0x46, 0x75, 0xea, 0x74, 0x5e, 0x28, 0x30, 0xd7, 0xc5, 0xf8, 0x0e,
+0xba, 0x71, 0x81, 0xe3, 0x08, 0xb6, 0x99, 0xb7, 0x11, 0xe0, 0x28, 0x8b, 0x6e, 0x34, 0xa3, 0x4e,
+0x59, 0x1b, 0x2f, 0xea, 0x62, 0x79, 0xcf, 0x4a, 0xfc, 0x2d, 0x38, 0x46, 0x20, 0xf8, 0x32, 0x32,
+0xf4, 0x19, 0xe3, 0x2e, 0x30, 0xac, 0xc8, 0x54, 0x67, 0xb0, 0xeb, 0x36, 0xba, 0xf6, 0xcc, 0x6b,
+0x8a, 0x34, 0x34, 0xf3, 0x81, 0x25, 0xb9, 0xfb, 0x2d, 0x59, 0x98, 0x7c, 0x85, 0x80, 0xb8, 0xb7,
+0x11, 0x7c, 0x68, 0xf8, 0x47, 0x20, 0xc1, 0x19, 0x91, 0xe7, 0xde, 0x2a, 0xbb, 0x57, 0x2e, 0x02,
+0x5a, 0xc7, 0xba, 0x95, 0x08, 0xd7, 0xda, 0xc6, 0x9c, 0xde, 0xe5, 0x35, 0xdb, 0x98, 0xd5, 0x3b,
+0xed, 0xbc, 0x55, 0x3b, 0x29, 0x1b, 0x24, 0x11, 0xd8, 0xf8, 0x1e, 0x26, 0x20, 0x0f, 0xf8, 0x84,
+0x20, 0x94, 0x2c, 0x95, 0x89, 0xd9, 0x0b, 0x28, 0x19, 0x15, 0xf9, 0xd2, 0xbd, 0xa1, 0xec, 0x52,
+0x77, 0xf7, 0x9c, 0xb7, 0x25, 0xa5, 0x11, 0xc2, 0xcd, 0x0f, 0xb3, 0x82, 0x6e, 0x93, 0x8d, 0x77,
+0x55, 0x04, 0x22, 0x8a, 0xe6, 0xd1, 0x01, 0x9e, 0x72, 0x65, 0xd8, 0x47, 0x5c, 0x03, 0x6c, 0x55,
+0x4d, 0xe6, 0x62, 0x62, 0x47, 0xef, 0x88, 0x5f, 0x11, 0xd6, 0x51, 0x14, 0xa8, 0x1e, 0x90, 0xa4,
+0xde, 0xe8, 0x7b, 0x84, 0xec, 0x2f, 0xa6, 0x28, 0x57, 0x73, 0x83, 0x30, 0x28, 0x35, 0xf8, 0xd9,
+0xe6, 0x1a, 0xd3, 0x86, 0xff, 0x21, 0xf6, 0x36, 0x57, 0x86, 0xe7, 0x96, 0xbf, 0x5f, 0x81, 0x17,
+0xc8, 0xb8, 0xb6, 0xb8, 0xb6, 0xdf, 0x4a, 0xb5, 0x28, 0x74, 0x86, 0xdc, 0x7b, 0x31, 0xb8, 0x51,
+0xc6, 0x24, 0x33, 0xdd, 0x76, 0x57, 0xc6, 0x5e, 0xd5, 0x9e, 0xae, 0xe2, 0xda, 0x66, 0xc1, 0xfc,
+0xaf, 0x71, 0x87, 0xa4, 0x80, 0xd0, 0x9b, 0x45, 0x23, 0x7e, 0xaf, 0xa5, 0xfc, 0x3f, 0xbf, 0x93,
+0xf1, 0x91, 0x65, 0x3d, 0x62, 0x49, 0x6c, 0x58, 0x8f, 0xb0, 0xa1, 0xbe, 0x98, 0x3a, 0x03, 0x73,
+0x04, 0x2f, 0x9f, 0x55, 0x1d, 0xf2, 0x37, 0x62, 0xde, 0x98, 0xd3, 0x2f, 0x47, 0x91, 0x47, 0x5b,
+0x9d, 0xa9, 0x58, 0xb0, 0x73, 0x07, 0x8b, 0x02, 0x7f, 0x5b, 0xc9, 0x05, 0xe2, 0xf9, 0x8a, 0x8e,
+0x12, 0xd0, 0xb5, 0xe4, 0xe0, 0x29, 0x64, 0x18, 0x5b, 0x20, 0x4e, 0x35, 0x11, 0x7a, 0x50, 0x2e,
+0x59, 0xb9, 0x20, 0x01, 0x89, 0x2f, 0x60, 0xa1, 0x9a, 0x23, 0xc0, 0x52, 0x9c, 0xd3, 0x02, 0xe2,
+0xe3, 0x35, 0x4e, 0x23, 0x72, 0xc5, 0x08, 0x22, 0xb4, 0x7e, 0xf7, 0x2a, 0x02, 0x91, 0xcc, 0x50,
+0x60, 0xc5, 0x4b, 0x8f, 0xd4, 0x9a, 0x28, 0xde, 0x20, 0x05, 0x05, 0xff, 0x54, 0xd1, 0x52, 0xfc,
+0x8b, 0x0c, 0x7d, 0xa1, 0xb0, 0xaa, 0x0a, 0x4b, 0x23, 0xf0, 0xbb, 0xce, 0xf8, 0xd2, 0x08, 0x16,
+0x81, 0x8d, 0x38, 0xf8, 0x42, 0xb8, 0x59, 0x7b, 0x89, 0xc0, 0xb6, 0x9c, 0xea, 0x2e, 0xb1, 0xbd,
+0xce, 0x15, 0x5f, 0x80, 0x4e, 0x91, 0xb9, 0x80, 0x50, 0x28, 0x39, 0x92, 0x12, 0x58, 0xd2, 0x50,
+0x44, 0x0f, 0x80, 0x3a, 0x24, 0xdf, 0x38, 0xf2, 0xdf, 0xa5, 0xde, 0x41, 0x6e, 0x92, 0x8d, 0xe5,
+0xb9, 0x6e, 0x19, 0x49, 0x94, 0xa3, 0x25, 0xc5, 0x48, 0x5b, 0x26, 0x28, 0x8a, 0x91, 0x28, 0x90,
+0x6b, 0xbc, 0xa1, 0xf2, 0x67, 0xa3, 0x33, 0x15, 0xae, 0xf4, 0xb3, 0xd1, 0xc0, 0x0e, 0x62, 0x59,
+0x94, 0xbb, 0x96, 0xde, 0x4b, 0xf6, 0xbe, 0x6c, 0xe1, 0x02, 0x85, 0x3c, 0x7d, 0x45, 0xc1, 0x27,
+0x62, 0xa0, 0xb0, 0xda, 0xb5, 0xde, 0x16, 0x11, 0xea, 0x42, 0xd5, 0xa2, 0x53, 0x29, 0xb8, 0x15,
+0x2a, 0x2c, 0xab, 0xa5, 0xc3, 0x87, 0xe2, 0xed, 0x03, 0xf9, 0x0f, 0xbd, 0x11, 0x5e, 0x0c, 0x24,
+0xfc, 0x96, 0xac, 0x77, 0xa8, 0x9c, 0x2e, 0x70, 0x4e, 0x5e, 0x95, 0x29, 0xa3, 0x8d, 0xbd, 0x0a,
+0x30, 0x52, 0x4f, 0x8c, 0x5a, 0xe4, 0xa3, 0x8f, 0x21, 0x42, 0x4a, 0x7b, 0x7b, 0xc6, 0x8e, 0x1d,
+0xe6, 0xc6, 0x29, 0xe2, 0x99, 0x6c, 0xa5, 0x6d, 0xf2, 0xd9, 0x1a, 0x25, 0x75, 0xf8, 0xac, 0x32,
+0xfd, 0xa6, 0x22, 0xa0, 0x88, 0x4b, 0xb9, 0x67, 0xd5, 0xb0, 0xf1, 0x6d, 0x34, 0x07, 0x55, 0x12,
+0xfa, 0x23, 0x1b, 0x71, 0x83, 0x12, 0xa7, 0x45, 0x58, 0xab, 0x2f, 0x20, 0x1d, 0xe7, 0xd5, 0x00,
+0x71, 0x72, 0xca, 0x4e, 0x17, 0x38, 0xc3, 0xc5, 0x7d, 0x14, 0x0a, 0xd6, 0x19, 0x23, 0xb9, 0xa6,
+0x1d, 0x0a, 0x9c, 0x5c, 0xc2, 0xba, 0xad, 0x24, 0x83, 0xeb, 0x16, 0x89, 0x04, 0x6a, 0x0f, 0x55,
+0x4a, 0x17, 0xe3, 0xe8, 0x65, 0x6c, 0x13, 0x43, 0x73, 0xdd, 0xb6, 0x17, 0xd0, 0x93, 0xcf, 0xf4,
+0xc5, 0x86, 0x9b, 0x92, 0x6b, 0xba, 0x98, 0xd6, 0x47, 0x52, 0x29, 0xbc, 0xf5, 0x41, 0xbf, 0xb5,
+0x09, 0xd2, 0xbb, 0x8b, 0xf1, 0x8d, 0x2a, 0xb0, 0x25, 0xfa, 0x9f, 0x9d, 0xdc, 0x76, 0x53, 0xfa,
+0x28, 0x0e, 0x82, 0x0e, 0xd5, 0xd7, 0x45, 0x16, 0xdc, 0xe8, 0xad, 0x8f, 0xf3, 0xcf, 0x26, 0x78,
+0x48, 0xcb, 0x31, 0xd2, 0x72, 0x14, 0x16, 0x5e, 0x83, 0x32, 0x7c, 0xac, 0xf1, 0xaf, 0xa5, 0x6e,
+0x15, 0x4a, 0xfa, 0xa8, 0xbc, 0x42, 0xc8, 0xb7, 0x7a, 0xa7, 0xa4, 0x29, 0x7f, 0xa3, 0x0a, 0xfd,
+0xa9, 0xe4, 0xff, 0x5b, 0x88, 0xc9, 0x87, 0xca, 0x9e, 0x2d, 0x23, 0xe8, 0x35, 0x6b, 0xcf, 0xdd,
+0x6d, 0x1f, 0x3e, 0x26, 0xe8, 0x16, 0x3d, 0x72, 0x73, 0x01, 0xf9, 0x50, 0x68, 0xdc, 0xbe, 0xb8,
+0x31, 0xf2, 0x4f, 0x63, 0x88, 0xbd, 0xef, 0x1e, 0x7e, 0xf3, 0x03, 0x3c, 0x54, 0x3e, 0x02, 0xcb,
+0x16, 0x1e, 0xc5, 0x7f, 0x0c, 0xae, 0xc8, 0xd4, 0xfd, 0x2d, 0x27, 0xec, 0x99, 0xa1, 0xfc, 0xbe,
+0x27, 0x9f, 0xc0, 0x75, 0xc7, 0x87, 0x0b, 0x68, 0xe3, 0xd8, 0x98, 0x18, 0x7a, 0x45, 0x49, 0xc7,
+0xa7, 0x80, 0x70, 0x02, 0x90, 0x32, 0x6c, 0xd1, 0x29, 0x94, 0xc0, 0x28, 0x19, 0x03, 0xda, 0xe8,
+0xd0, 0x27, 0x89, 0x6f, 0x53, 0x53, 0x1f, 0x79, 0x4f, 0x54, 0x7d, 0x2e, 0x23, 0x4f, 0x04, 0xea,
+0x94, 0xce, 0x8d, 0xd4, 0x7b, 0xdb, 0x87, 0xc6, 0x33, 0xc1, 0xa9, 0x1a, 0xa9, 0xa6, 0x2c, 0x50,
+0x20, 0xb6, 0x23, 0xdd, 0x76, 0x6e, 0x9a, 0x7b, 0x43, 0x45, 0x99, 0x53, 0x3e, 0x91, 0xa5, 0x3b,
+0x47, 0x88, 0x9e, 0xac, 0xc4, 0x4c, 0x5b, 0x54, 0x3d, 0xf3, 0x3d, 0xe9, 0x90, 0xb3, 0xcc, 0x48,
+0x2a, 0xd4, 0x76, 0xe3, 0x19, 0x37, 0xe8, 0x60, 0x2b, 0x35, 0xcd, 0x0d, 0x65, 0x9f, 0x1e, 0x28,
+0xd4, 0xba, 0x7d, 0x49, 0xde, 0x13, 0xac, 0x53, 0x32, 0xcd, 0x74, 0xb1, 0x19, 0x1b, 0xae, 0xfb,
+0x38, 0x17, 0xc8, 0x5b, 0xc4, 0xbd, 0x26, 0xeb, 0x93, 0xe3, 0x89, 0x2e, 0xcf, 0x0d, 0xf7, 0x89,
+0xd0, 0x66, 0xdc, 0xf6, 0x16, 0x7d, 0x8a, 0x20, 0x50, 0xec, 0xda, 0x49, 0x08, 0x9f, 0xb0, 0x4b,
+0xe1, 0x9b, 0xe9, 0xdc, 0x7b, 0x3a, 0x8e, 0xdf, 0x0f, 0x2a, 0x75, 0x3c, 0x9e, 0xff, 0x80, 0x74,
+0x57, 0xea, 0x64, 0xa1, 0x6d, 0x39, 0x41, 0xb6, 0x48, 0xe6, 0xdc, 0x47, 0xe4, 0x1e, 0xd8, 0x8f,
+0x22, 0xfb, 0xec, 0x60, 0xcf, 0xcd, 0x78, 0xd7, 0xc7, 0xf0, 0xba, 0x32, 0x9d, 0xf3, 0x88, 0xa2,
+0x70, 0x77, 0x7e, 0xc1, 0x39, 0xd1, 0x68, 0xff, 0x9b, 0x21, 0x49, 0x04, 0x60, 0x4e, 0xe9, 0x24,
+0xc5, 0x39, 0xd5, 0x59, 0x49, 0xed, 0x74, 0xc1, 0x79, 0x68, 0x2f, 0x4a, 0x3d, 0x91, 0x6d, 0x09,
+0x1b, 0xc8, 0x47, 0xa5, 0xcc, 0x71, 0xcb, 0xbc, 0x2b, 0xa6, 0xf9, 0x6c, 0x90, 0xc2, 0x27, 0x12,
+0xcd, 0x96, 0xe5, 0x8e, 0xdc, 0xc4, 0xdf, 0x3c, 0x3c, 0xe2, 0x20, 0x06, 0xd5, 0xe0, 0x6a, 0xc2,
+0x70, 0xc6, 0x74, 0xbb, 0xb9, 0x3f, 0x90, 0x1e, 0x75, 0x09, 0x17, 0x9a, 0xcc, 0x65, 0x11, 0x5e,
+0x0c, 0x26, 0x5d, 0x2d, 0x70, 0x59, 0x24, 0x65, 0x37, 0xd1, 0x56, 0x9b, 0xf1, 0xf4, 0x85, 0x6f,
+0xb2, 0xc9, 0xee, 0x96, 0xc8, 0x26, 0x8d, 0x1e, 0x07, 0xc3, 0x0b, 0x43, 0xe5, 0x8f, 0x56, 0x09,
+0xd9, 0x05, 0xac, 0xd1, 0xa9, 0x16, 0xec, 0x7e, 0xa9, 0xc5, 0xb7, 0xa3, 0x51, 0x52, 0xab, 0x12,
+0x25, 0x4d, 0xb2, 0x52, 0x93, 0x92, 0x56, 0xa1, 0xbc, 0x43, 0x28, 0x1b, 0xa7, 0xaf, 0xba, 0xe0,
+0x5d, 0x34, 0xdd, 0xeb, 0x77, 0x48, 0x66, 0x64, 0xf5, 0xf7, 0xee, 0xd8, 0x19, 0x74, 0xfb, 0x23,
+0x43, 0xcf, 0xba, 0xa3, 0x7c, 0xdc, 0x6d, 0x4d, 0x55, 0x89, 0x5a, 0xdd, 0x4e, 0x74, 0xe8, 0xa0,
+0xc8, 0x8e, 0x6a, 0x5f, 0x2b, 0x9e, 0xf4, 0xb6, 0x86, 0x1a, 0x8a, 0x72, 0x32, 0xbf, 0x35, 0xa4,
+0x89, 0x22, 0xdd, 0x8d, 0xf6, 0xb7, 0x76, 0x2a, 0xb7, 0xaa, 0x62, 0xd3, 0x89, 0xfb, 0x6c, 0x08,
+0xa1, 0x51, 0x4f, 0x54, 0xf0, 0x19, 0x3b, 0xca, 0x6b, 0x93, 0xc2, 0xb8, 0x9b, 0x69, 0x58, 0xc1,
+0x33, 0x47, 0x76, 0x36, 0xa5, 0xae, 0x77, 0xe5, 0xa8, 0x96, 0x0d, 0x57, 0x1d, 0x4f, 0x84, 0x38,
+0xe3, 0xc5, 0x10, 0xfc, 0x80, 0xe4, 0xcd, 0x5f, 0x9c, 0xaf, 0xdf, 0xc7, 0x7d, 0x5f, 0x9a, 0xf6,
+0xc3, 0x52, 0x4d, 0x06, 0xfa, 0xaa, 0xd5, 0x49, 0x8e, 0x23, 0xeb, 0xaf, 0x86, 0x72, 0xbd, 0x1f,
+0x03, 0x57, 0x80, 0x4e, 0x21, 0xbc, 0x11, 0xa4, 0x2d, 0x26, 0xff, 0xf9, 0xa6, 0x60, 0x81, 0x08,
+0xec, 0x76, 0xe8, 0x2a, 0x7a, 0xd0, 0xa1, 0x61, 0x38, 0xcd, 0x09, 0xb5, 0x69, 0x88, 0x7d, 0x1f,
+0x8f, 0x7c, 0x7e, 0xa3, 0x19, 0x90, 0x1b, 0x74, 0x3e, 0xbe, 0x57, 0xc8, 0x00, 0xa1, 0xdf, 0xa6,
+0xfe, 0xed, 0x72, 0x42, 0x76, 0x0a, 0x05, 0x8b, 0xeb, 0xdb, 0xf2, 0x01, 0xfd, 0x44, 0x8e, 0x23,
+0x60, 0x81, 0xae, 0x4d, 0xbb, 0x68, 0xaf, 0x67, 0xd5, 0x55, 0x5b, 0x3a, 0xf7, 0x1b, 0x03, 0xb8,
+0x66, 0x8f, 0x0a, 0xee, 0x5e, 0xb1, 0x2b, 0x74, 0x34, 0x1b, 0x19, 0xf8, 0x01, 0x29, 0xde, 0x5e,
+0x80, 0x84, 0x82, 0xe6, 0xc4, 0x0f, 0x82, 0x09, 0xcc, 0xb1, 0x8f, 0xd7, 0x86, 0x74, 0xcf, 0xce,
+0x08, 0xde, 0x38, 0xdd, 0x0c, 0x0f, 0x7b, 0x02, 0x64, 0x28, 0x38, 0x79, 0xd0, 0x7d, 0x5a, 0x18,
+0xf1, 0x90, 0xd1, 0x75, 0x3c, 0xf5, 0x96, 0xdc, 0xa1, 0x37, 0xbe, 0x11, 0xba, 0xf3, 0x59, 0xef,
+0x5a, 0x23, 0xf2, 0xc0, 0x29, 0x42, 0x4d, 0x04, 0x3d, 0x69, 0xe4, 0xf8, 0x73, 0x96, 0x98, 0x40,
+0x98, 0x79, 0xf2, 0x80, 0xee, 0x24, 0x42, 0x17, 0xca, 0xa4, 0xec, 0xdd, 0x05, 0x8f, 0x2b, 0x54,
+0x7e, 0x65, 0x84, 0xac, 0x3b, 0x58, 0x6e, 0xb8, 0xf2, 0x5d, 0x9b, 0xfd, 0x7a, 0xbf, 0xd8, 0x4c,
+0x5f, 0x7f, 0xfa, 0x8b, 0xf8, 0xfe, 0xab, 0xfc, 0x8e, 0x06, 0xa2, 0x91, 0xbf, 0x09, 0x42, 0x7e,
+0xff, 0x26, 0xbe, 0xff, 0x2e, 0xbe, 0xff, 0x21, 0xbe, 0xff, 0x29, 0xbe, 0xff, 0x25, 0xbe, 0xff,
+0x2d, 0xbe, 0xff, 0x33, 0x7d, 0x7f, 0xf8, 0xeb, 0x6f, 0x92, 0x10, 0xbb, 0x8e, 0xec, 0x39, 0xa5,
+0xec, 0x41, 0x67, 0xe5, 0x99, 0x7e, 0x99, 0x0d, 0xb7, 0x7b, 0xd9, 0xcc, 0x86, 0x2f, 0x1b, 0x2a,
+0xdb, 0xe6, 0x14, 0x79, 0x02, 0xfd, 0x87, 0x37, 0xc1, 0xed, 0xee, 0xbc, 0xe3, 0x9d, 0x42, 0x4a,
+0x6e, 0x60, 0xeb, 0xf9, 0xe9, 0xe1, 0x7c, 0x80, 0x6c, 0xce, 0xee, 0x64, 0x79, 0x03, 0x10, 0x24,
+0x89, 0x68, 0x62, 0x05, 0x84, 0x0a, 0xe2, 0x54, 0x29, 0x9e, 0xe9, 0x1b, 0x65, 0x0a, 0x47, 0x27,
+0x1b, 0x1a, 0x11, 0xd7, 0x47, 0x9f, 0x81, 0x46, 0x2f, 0xa4, 0x1b, 0x43, 0x7b, 0x92, 0x98, 0x6f,
+0x1a, 0x65, 0xe4, 0x3e, 0x08, 0xe4, 0x14, 0x5e, 0x88, 0x24, 0x94, 0xc3, 0x63, 0x62, 0xa4, 0x41,
+0x78, 0x52, 0x62, 0x73, 0xe4, 0x3b, 0x40, 0x24, 0xee, 0x35, 0xc3, 0x1f, 0xb4, 0x49, 0xd1, 0x2c,
+0x24, 0xd8, 0x88, 0xa5, 0x7b, 0x9d, 0xba, 0xf0, 0x3c, 0xe9, 0x04, 0x84, 0xc6, 0xc1, 0xf6, 0x35,
+0xdb, 0x19, 0x81, 0x0f, 0x61, 0xeb, 0x4a, 0x4f, 0xc8, 0xe7, 0xc6, 0xa8, 0xd0, 0x8a, 0x2c, 0xa4,
+0x40, 0x3e, 0x23, 0x35, 0xdb, 0x3e, 0x11, 0x9e, 0x11, 0x24, 0xca, 0x68, 0xa3, 0x79, 0x88, 0xc6,
+0xe0, 0xdb, 0x9d, 0x8a, 0x95, 0x01, 0xd4, 0x6a, 0x2f, 0x29, 0xc7, 0x82, 0x7c, 0x82, 0x0b, 0xb2,
+0x38, 0xe3, 0x69, 0x8b, 0x0b, 0x6c, 0xfb, 0x62, 0x77, 0x80, 0x18, 0xca, 0x92, 0x53, 0xfc, 0x77,
+0x55, 0x07, 0xaf, 0x28, 0x26, 0x0c, 0x91, 0x04, 0x9d, 0xb2, 0xa4, 0xfb, 0x27, 0xd9, 0x91, 0x84,
+0xef, 0x96, 0x54, 0x8b, 0x5d, 0x50, 0x3a, 0x9c, 0x82, 0xe3, 0x40, 0xb2, 0xa5, 0x53, 0xeb, 0x32,
+0xd2, 0x4d, 0xc6, 0x87, 0x89, 0xfe, 0xd2, 0x18, 0x31, 0x8a, 0x4e, 0x4f, 0x0b, 0x8d, 0xae, 0x38,
+0x2f, 0xd8, 0xf5, 0x0f, 0x20, 0x03, 0x14, 0x1e, 0xc0, 0x85, 0xa9, 0x3c, 0xeb, 0x42, 0x8c, 0x3e,
+0xf7, 0xfd, 0xee, 0x99, 0x3a, 0xa5, 0x2d, 0x92, 0xb4, 0x4d, 0x02, 0xc7, 0x96, 0x25, 0xe6, 0x68,
+0xab, 0xf6, 0x17, 0x48, 0x2b, 0x45, 0xb9, 0xd6, 0xf5, 0x9b, 0xc2, 0x17, 0x0b, 0x05, 0xad, 0x2b,
+0xde, 0x6d, 0xe5, 0x51, 0xfc, 0xa6, 0xe5, 0x49, 0x2d, 0x67, 0x55, 0xc9, 0x46, 0x78, 0xc6, 0x86,
+0x0c, 0x74, 0x28, 0x04, 0xb5, 0x41, 0x84, 0xb6, 0x62, 0x8b, 0x17, 0x83, 0x74, 0xcd, 0x7b, 0x29,
+0xbc, 0x97, 0x63, 0x89, 0xfb, 0xb3, 0x90, 0xff, 0x2b, 0xe5, 0xfe, 0x28, 0xc9, 0x50, 0x59, 0x8b,
+0x4d, 0x43, 0x02, 0x93, 0x3a, 0x7e, 0xd5, 0xc6, 0x6a, 0x2f, 0x44, 0xfa, 0xca, 0xa6, 0xe0, 0xd8,
+0x8e, 0xbe, 0xa2, 0x42, 0x22, 0xa1, 0x92, 0x3f, 0xa8, 0x70, 0x2a, 0x95, 0x34, 0x92, 0x39, 0x1f,
+0xcb, 0x4e, 0x30, 0xfb, 0x87, 0x77, 0x7d, 0xe4, 0xe8, 0x9f, 0xb7, 0xc2, 0x2f, 0x15, 0xb0, 0x2d,
+0xa4, 0x2b, 0x7d, 0x12, 0xe5, 0x19, 0x9d, 0x95, 0xe7, 0x9f, 0x9d, 0x46, 0x1a, 0xea, 0x6d, 0xfb,
+0x66, 0x6f, 0x80, 0x38, 0x8b, 0x66, 0x70, 0x78, 0xd1, 0x99, 0xe8, 0xb9, 0x72, 0x50, 0xb7, 0x39,
+0x79, 0xe2, 0x19, 0x5a, 0x50, 0xa9, 0x24, 0x65, 0x90, 0xa0, 0x55, 0x23, 0x11, 0xf0, 0xd6, 0xf6,
+0x97, 0x1e, 0xa1, 0x8e, 0xdb, 0x56, 0xac, 0x7a, 0x56, 0xde, 0xf6, 0xcf, 0xf8, 0x2b, 0x42, 0x4f,
+0x1e, 0x12, 0xf2, 0xee, 0xa4, 0xbf, 0x91, 0xf4, 0x59, 0x65, 0xfa, 0x82, 0x67, 0x80, 0x6e, 0xd8,
+0x17, 0xe8, 0x0e, 0x86, 0x3e, 0x6b, 0x80, 0x71, 0xc7, 0xb6, 0x3c, 0x85, 0xc0, 0x09, 0xe9, 0xdf,
+0x3d, 0x06, 0xfa, 0x8e, 0x9a, 0xfe, 0xe1, 0x64, 0x04, 0xde, 0xa8, 0x95, 0x5b, 0xdc, 0x85, 0xd6,
+0x14, 0x05, 0x43, 0x27, 0xb0, 0x4f, 0x28, 0x2e, 0xf9, 0x8d, 0x25, 0xa2, 0xb7, 0x5a, 0x92, 0xde,
+0xd2, 0x5b, 0xff, 0x13, 0xe5, 0x00, 0xdd, 0xa3, 0xb8, 0xdd, 0x9d, 0x25, 0x3e, 0x61, 0x75, 0xaa,
+0xa3, 0xd3, 0xc3, 0x9b, 0x2e, 0x19, 0x58, 0xcd, 0x29, 0xaa, 0x0b, 0x54, 0xde, 0x01, 0x45, 0x3f,
+0x9b, 0x3e, 0xd8, 0x0f, 0x10, 0x02, 0x0c, 0xc4, 0x8a, 0x96, 0x4c, 0x1e, 0x39, 0xe7, 0xc6, 0x91,
+0xbc, 0xcb, 0xfc, 0x40, 0x5b, 0x54, 0xf8, 0x5a, 0xca, 0x76, 0x41, 0x5b, 0xef, 0x38, 0x02, 0xdc,
+0xbb, 0x57, 0x0d, 0x49, 0x46, 0x17, 0x3a, 0x3f, 0x90, 0x94, 0xc0, 0x12, 0x7a, 0x94, 0xe7, 0x2f,
+0xb5, 0x97, 0x07, 0x2d, 0xd9, 0xbd, 0xa1, 0xde, 0x8f, 0x10, 0x5f, 0x2b, 0xa9, 0xc4, 0x15, 0x64,
+0x91, 0xac, 0xfa, 0x37, 0x91, 0x09, 0x33, 0x24, 0x77, 0x5d, 0xe9, 0x36, 0x23, 0xed, 0x24, 0xbb,
+0x2b, 0x2e, 0x6d, 0x5f, 0x9a, 0x4e, 0x88, 0x6b, 0x93, 0x45, 0xff, 0x40, 0x22, 0xe0, 0x67, 0xd4,
+0x5d, 0x2d, 0xca, 0x6c, 0x79, 0xe6, 0x1a, 0x65, 0x2d, 0xc9, 0xdd, 0x36, 0x84, 0x8e, 0x4f, 0x47,
+0x80, 0xa3, 0x83, 0x5c, 0xb2, 0x09, 0x5b, 0xb4, 0x68, 0x94, 0x04, 0xf6, 0x95, 0x2a, 0x15, 0x91,
+0x26, 0xbc, 0x79, 0xff, 0xef, 0xff, 0xcf, 0x0d, 0x81, 0x71, 0xda, 0x1f, 0x00, 0x00,
+};
+constexpr size_t timezonesJsonGzSize = 2750;
@@ -0,0 +1,110 @@
+#pragma once
+
+// host stand-in for the ESP8266 Arduino core, only the parts used by the clock are provided
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <sys/time.h>
+
+#include "Print.h"
+#include "Sim.h"
+#include "WString.h"
+#include "pgmspace.h"
+
+#define ARDUINO_HOST_SIM 1
+
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+#define ICACHE_FLASH_ATTR
+#define RF_PRE_INIT() void __host_rf_pre_init()
+
+#define LOW 0x0
+#define HIGH 0x1
+
+#define INPUT 0x00
+#define INPUT_PULLUP 0x02
+#define OUTPUT 0x01
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define ONLOW 0x04
+#define ONHIGH 0x05
+#define ONLOW_WE 0x0C
+#define ONHIGH_WE 0x0D
+
+#define SDA 4
+#define SCL 5
+
+using byte = uint8_t;
+
+inline unsigned long millis() { return sim::millis(); }
+inline unsigned long micros() { return sim::micros(); }
+inline void delay(unsigned long ms) { sim::advanceMillis(ms); }
+inline void delayMicroseconds(unsigned int us) { sim::advanceMicros(us); }
+inline void yield() { }
+inline void optimistic_yield(uint32_t) { }
+
+inline void pinMode(uint8_t pin, uint8_t mode) { sim::pinMode(pin, mode); }
+inline int digitalRead(uint8_t pin) { return sim::digitalRead(pin); }
+inline void digitalWrite(uint8_t pin, uint8_t value) { sim::digitalWrite(pin, value); }
+inline void attachInterrupt(uint8_t, void (*)(), int) { }
+inline void attachInterruptArg(uint8_t, void (*)(void *), void *, int) { }
+inline void detachInterrupt(uint8_t) { }
+inline void noInterrupts() { }
+inline void interrupts() { }
+
+inline void setTZ(const char *tz) {
+    setenv("TZ", tz, 1);
+    tzset();
+}
+inline void configTime(const char *tz, const char *, const char * = nullptr, const char * = nullptr) { setTZ(tz); }
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long, int = 0, int = 0) { }
+    void end() { }
+
+    size_t write(uint8_t c) override { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    int availableForWrite() override { return 128; }
+    void flush() override { fflush(stdout); }
+
+    int available() override { return sim::serialAvailable(); }
+    int read() override { return sim::serialRead(); }
+    int peek() override { return sim::serialPeek(); }
+
+    using Print::write;
+};
+extern HardwareSerial Serial;
+
+enum SerialConfig { SERIAL_8N1 = 0x1c };
+enum SerialMode { SERIAL_FULL = 0, SERIAL_RX_ONLY = 1, SERIAL_TX_ONLY = 2 };
+
+enum rst_reason { REASON_DEFAULT_RST = 0, REASON_WDT_RST, REASON_EXCEPTION_RST, REASON_SOFT_WDT_RST, REASON_SOFT_RESTART, REASON_DEEP_SLEEP_AWAKE, REASON_EXT_SYS_RST };
+struct rst_info {
+    uint32_t reason;
+};
+enum RFMode { RF_DEFAULT = 0, RF_CAL = 1, RF_NO_CAL = 2, RF_DISABLED = 4 };
+#define WAKE_RF_DEFAULT RF_DEFAULT
+#define WAKE_RF_DISABLED RF_DISABLED
+
+class EspClass {
+public:
+    uint32_t getCycleCount() { return sim::cycleCount(); }
+    uint32_t getFreeHeap() { return 40 * 1024; }
+    uint32_t getCpuFreqMHz() { return 160; }
+    void restart() { std::exit(0); }
+    void reset() { std::exit(0); }
+    void deepSleep(uint64_t us, RFMode = RF_DEFAULT) { sim::advanceMicros(us); }
+    rst_info *getResetInfoPtr() {
+        static rst_info info{REASON_DEFAULT_RST};
+        return &info;
+    }
+};
+extern EspClass ESP;
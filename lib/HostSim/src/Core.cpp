@@ -0,0 +1,46 @@
+#include <Arduino.h>
+#include <Schedule.h>
+#include <Wire.h>
+#include <coredecls.h>
+#include <vector>
+
+TwoWire Wire;
+
+namespace {
+BoolCB timeCallback;
+std::vector<std::function<void(void)>> scheduled;
+} // namespace
+
+void settimeofday_cb(const BoolCB &cb) { timeCallback = cb; }
+void settimeofday_cb(const TrivialCB &cb) {
+    timeCallback = [cb](bool) { cb(); };
+}
+
+uint32_t crc32(const void *data, size_t length, uint32_t crc) {
+    // same bit order and polynomial as the ESP8266 core
+    const uint8_t *ldata = static_cast<const uint8_t *>(data);
+    while(length--) {
+        const uint8_t c = *ldata++;
+        for(uint32_t i = 0x80; i > 0; i >>= 1) {
+            bool bit = crc & 0x80000000;
+            if(c & i)
+                bit = !bit;
+            crc <<= 1;
+            if(bit)
+                crc ^= 0x04c11db7;
+        }
+    }
+    return crc;
+}
+
+bool schedule_function(const std::function<void(void)> &fn) {
+    scheduled.push_back(fn);
+    return true;
+}
+
+void run_scheduled_functions() {
+    auto fns = std::move(scheduled);
+    scheduled.clear();
+    for(auto &fn : fns)
+        fn();
+}
@@ -0,0 +1,48 @@
+#include <filesystem>
+
+#include "LittleFS.h"
+
+// relative to the working directory of the simulation
+fs::FS LittleFS(".littlefs");
+
+namespace fs {
+
+bool FS::begin() { return std::filesystem::create_directories(root) || std::filesystem::is_directory(root); }
+
+bool FS::format() {
+    std::filesystem::remove_all(root);
+    return begin();
+}
+
+File FS::open(const char *path, const char *mode) {
+    const std::string p = hostPath(path);
+    // LittleFS creates the parent directories on write
+    if(mode[0] != 'r')
+        std::filesystem::create_directories(std::filesystem::path(p).parent_path());
+
+    std::string m = mode;
+    if(m.find('b') == std::string::npos)
+        m += 'b';
+    std::FILE *f = std::fopen(p.c_str(), m.c_str());
+    return f ? File(f) : File();
+}
+
+bool FS::exists(const char *path) { return std::filesystem::exists(hostPath(path)); }
+
+bool FS::remove(const char *path) {
+    std::error_code ec;
+    return std::filesystem::remove(hostPath(path), ec);
+}
+
+bool FS::rename(const char *pathFrom, const char *pathTo) {
+    std::error_code ec;
+    std::filesystem::rename(hostPath(pathFrom), hostPath(pathTo), ec);
+    return !ec;
+}
+
+bool FS::mkdir(const char *path) {
+    std::error_code ec;
+    return std::filesystem::create_directories(hostPath(path), ec);
+}
+
+} // namespace fs
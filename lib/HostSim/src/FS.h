@@ -0,0 +1,81 @@
+#pragma once
+
+// host stand-in for the ESP8266 file system API, files live in a directory on the host
+
+#include <Arduino.h>
+#include <cstdio>
+#include <memory>
+
+namespace fs {
+
+class File : public Stream {
+public:
+    File() = default;
+    explicit File(std::FILE *f) : file(f, &std::fclose) { }
+
+    size_t write(uint8_t c) override { return file ? std::fwrite(&c, 1, 1, file.get()) : 0; }
+    size_t write(const uint8_t *buf, size_t size) override { return file ? std::fwrite(buf, 1, size, file.get()) : 0; }
+    using Print::write;
+
+    int available() override { return file ? size() - position() : 0; }
+    int read() override { return file ? std::fgetc(file.get()) : -1; }
+    int peek() override {
+        if(!file)
+            return -1;
+        const int c = std::fgetc(file.get());
+        if(c >= 0)
+            std::ungetc(c, file.get());
+        return c;
+    }
+    size_t read(uint8_t *buf, size_t size) { return file ? std::fread(buf, 1, size, file.get()) : 0; }
+    size_t readBytes(char *buffer, size_t length) override { return read(reinterpret_cast<uint8_t *>(buffer), length); }
+
+    void flush() override {
+        if(file)
+            std::fflush(file.get());
+    }
+
+    size_t position() const { return file ? std::ftell(file.get()) : 0; }
+    size_t size() const {
+        if(!file)
+            return 0;
+        const long pos = std::ftell(file.get());
+        std::fseek(file.get(), 0, SEEK_END);
+        const long end = std::ftell(file.get());
+        std::fseek(file.get(), pos, SEEK_SET);
+        return end;
+    }
+    bool seek(uint32_t pos) { return file && std::fseek(file.get(), pos, SEEK_SET) == 0; }
+
+    void close() { file.reset(); }
+    operator bool() const { return bool(file); }
+
+private:
+    std::shared_ptr<std::FILE> file;
+};
+
+class FS {
+public:
+    explicit FS(const char *root) : root(root) { }
+
+    bool begin();
+    void end() { }
+    bool format();
+
+    File open(const char *path, const char *mode);
+    File open(const String &path, const char *mode) { return open(path.c_str(), mode); }
+    bool exists(const char *path);
+    bool remove(const char *path);
+    bool rename(const char *pathFrom, const char *pathTo);
+    bool mkdir(const char *path);
+
+private:
+    std::string hostPath(const char *path) const { return root + path; }
+
+    std::string root;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
@@ -0,0 +1,320 @@
+#pragma once
+
+// host stand-in for the subset of FastLED used by the clock
+// colour math follows the FastLED implementation closely enough for rendering and benchmarking,
+// hsv2rgb is a simplified approximation of the rainbow conversion
+
+#include <Arduino.h>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#define FL_PROGMEM PROGMEM
+#define FASTLED_HOST_SIM 1
+
+typedef uint8_t fract8;
+typedef uint16_t fract16;
+
+inline uint8_t scale8(uint8_t i, fract8 scale) { return (uint16_t(i) * (1 + uint16_t(scale))) >> 8; }
+inline uint8_t scale8_video(uint8_t i, fract8 scale) { return (uint16_t(i) * scale >> 8) + ((i && scale) ? 1 : 0); }
+inline uint16_t scale16(uint16_t i, fract16 scale) { return (uint32_t(i) * (1 + uint32_t(scale))) >> 16; }
+inline uint8_t qadd8(uint8_t i, uint8_t j) { return std::min(int(i) + j, 255); }
+inline uint8_t qsub8(uint8_t i, uint8_t j) { return std::max(int(i) - j, 0); }
+inline uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+    return (b > a) ? a + scale8(b - a, frac) : a - scale8(a - b, frac);
+}
+
+inline int16_t sin16(uint16_t theta) {
+    static const uint16_t base[] = {0, 6393, 12539, 18204, 23170, 27245, 30273, 32137};
+    static const uint8_t slope[] = {49, 48, 44, 38, 31, 23, 14, 4};
+
+    uint16_t offset = (theta & 0x3FFF) >> 3; // 0..2047
+    if(theta & 0x4000)
+        offset = 2047 - offset;
+
+    const uint8_t section = offset / 256; // 0..7
+    const uint16_t b = base[section];
+    const uint8_t m = slope[section];
+    const uint8_t secoffset8 = uint8_t(offset) / 2;
+    const uint16_t mx = m * secoffset8;
+    int16_t y = mx + b;
+    if(theta & 0x8000)
+        y = -y;
+    return y;
+}
+inline int16_t cos16(uint16_t theta) { return sin16(theta + 16384); }
+
+struct CHSV {
+    uint8_t h{0}, s{0}, v{0};
+    CHSV() = default;
+    constexpr CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) { }
+};
+
+struct CRGB {
+    union {
+        struct {
+            uint8_t r, g, b;
+        };
+        uint8_t raw[3];
+    };
+
+    enum HTMLColorCode : uint32_t {
+        Aqua = 0x00FFFF,
+        Aquamarine = 0x7FFFD4,
+        Black = 0x000000,
+        Blue = 0x0000FF,
+        CadetBlue = 0x5F9EA0,
+        CornflowerBlue = 0x6495ED,
+        DarkBlue = 0x00008B,
+        DarkCyan = 0x008B8B,
+        DarkGreen = 0x006400,
+        DarkOliveGreen = 0x556B2F,
+        ForestGreen = 0x228B22,
+        Green = 0x008000,
+        LawnGreen = 0x7CFC00,
+        LightGreen = 0x90EE90,
+        LightSkyBlue = 0x87CEFA,
+        LimeGreen = 0x32CD32,
+        MediumAquamarine = 0x66CDAA,
+        MediumBlue = 0x0000CD,
+        MidnightBlue = 0x191970,
+        Navy = 0x000080,
+        OliveDrab = 0x6B8E23,
+        Red = 0xFF0000,
+        SeaGreen = 0x2E8B57,
+        Teal = 0x008080,
+        White = 0xFFFFFF,
+        YellowGreen = 0x9ACD32,
+    };
+
+    CRGB() = default;
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) { }
+    constexpr CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) { }
+    constexpr CRGB(HTMLColorCode colorcode) : CRGB(uint32_t(colorcode)) { }
+    CRGB(const CHSV &hsv) { *this = hsv; }
+
+    CRGB &operator=(const CHSV &hsv) {
+        // six hue sections, then desaturate and dim with video scaling so low values never become black
+        const uint8_t region = hsv.h / 43;
+        const uint8_t rem = (hsv.h - region * 43) * 6;
+        const uint8_t up = rem, down = 255 - rem;
+        uint8_t c[3];
+        switch(region) {
+            case 0: c[0] = 255, c[1] = up, c[2] = 0; break;
+            case 1: c[0] = down, c[1] = 255, c[2] = 0; break;
+            case 2: c[0] = 0, c[1] = 255, c[2] = up; break;
+            case 3: c[0] = 0, c[1] = down, c[2] = 255; break;
+            case 4: c[0] = up, c[1] = 0, c[2] = 255; break;
+            default: c[0] = 255, c[1] = 0, c[2] = down; break;
+        }
+        const uint8_t desat = 255 - hsv.s;
+        for(int i = 0; i < 3; i++)
+            raw[i] = scale8_video(qadd8(scale8(c[i], hsv.s), desat), hsv.v);
+        return *this;
+    }
+    CRGB &operator=(uint32_t colorcode) { return *this = CRGB(colorcode); }
+
+    explicit operator bool() const { return r || g || b; }
+    bool operator==(const CRGB &rhs) const { return r == rhs.r && g == rhs.g && b == rhs.b; }
+    bool operator!=(const CRGB &rhs) const { return !(*this == rhs); }
+
+    uint8_t &operator[](uint8_t x) { return raw[x]; }
+    const uint8_t &operator[](uint8_t x) const { return raw[x]; }
+
+    CRGB &nscale8(uint8_t scale) {
+        r = scale8(r, scale), g = scale8(g, scale), b = scale8(b, scale);
+        return *this;
+    }
+};
+
+inline CRGB blend(const CRGB &p1, const CRGB &p2, fract8 amountOfP2) {
+    return CRGB(lerp8by8(p1.r, p2.r, amountOfP2), lerp8by8(p1.g, p2.g, amountOfP2), lerp8by8(p1.b, p2.b, amountOfP2));
+}
+inline CRGB &nblend(CRGB &existing, const CRGB &overlay, fract8 amountOfOverlay) { return existing = blend(existing, overlay, amountOfOverlay); }
+
+template <class PIXEL_TYPE> class CPixelView {
+public:
+    CPixelView(PIXEL_TYPE *_leds, int _start, int _end) : dir(((_end - _start) < 0) ? -1 : 1), len((_end - _start) + dir), leds(_leds + _start) { }
+    CPixelView(PIXEL_TYPE *_leds, int _len) : dir(_len < 0 ? -1 : 1), len(_len), leds(_leds) { }
+
+    CPixelView &operator=(const PIXEL_TYPE &color) {
+        for(int i = 0; i != len; i += dir)
+            leds[i] = color;
+        return *this;
+    }
+    CPixelView &operator=(const CHSV &color) { return *this = PIXEL_TYPE(color); }
+
+    int size() const { return std::abs(len); }
+    PIXEL_TYPE &operator[](int x) { return leds[x]; }
+    const PIXEL_TYPE &operator[](int x) const { return leds[x]; }
+    operator PIXEL_TYPE *() { return leds; }
+    operator const PIXEL_TYPE *() const { return leds; }
+
+    PIXEL_TYPE *begin() { return leds; }
+    PIXEL_TYPE *end() { return leds + len; }
+    const PIXEL_TYPE *begin() const { return leds; }
+    const PIXEL_TYPE *end() const { return leds + len; }
+
+protected:
+    int8_t dir;
+    int len;
+    PIXEL_TYPE *leds;
+};
+using CRGBSet = CPixelView<CRGB>;
+
+template <int SIZE> class CRGBArray : public CPixelView<CRGB> {
+public:
+    CRGBArray() : CPixelView<CRGB>(rawleds, SIZE) { }
+    CRGBArray(const CRGBArray &) = delete;
+
+private:
+    CRGB rawleds[SIZE]{};
+};
+
+typedef uint32_t TProgmemRGBPalette16[16];
+
+class CRGBPalette16 {
+public:
+    CRGB entries[16];
+
+    CRGBPalette16() = default;
+    CRGBPalette16(const TProgmemRGBPalette16 &rhs) { *this = rhs; }
+    CRGBPalette16 &operator=(const TProgmemRGBPalette16 &rhs) {
+        for(int i = 0; i < 16; i++)
+            entries[i] = CRGB(uint32_t(pgm_read_dword_near(rhs + i)));
+        return *this;
+    }
+    bool operator==(const CRGBPalette16 &rhs) const { return memcmp(entries, rhs.entries, sizeof(entries)) == 0; }
+    bool operator!=(const CRGBPalette16 &rhs) const { return !(*this == rhs); }
+
+    CRGB &operator[](uint8_t x) { return entries[x]; }
+    const CRGB &operator[](uint8_t x) const { return entries[x]; }
+};
+
+enum TBlendType { NOBLEND = 0, LINEARBLEND = 1 };
+
+inline CRGB ColorFromPalette(const CRGBPalette16 &pal, uint8_t index, uint8_t brightness = 255, TBlendType blendType = LINEARBLEND) {
+    const uint8_t hi4 = index >> 4;
+    const uint8_t lo4 = index & 0x0F;
+
+    const CRGB &entry = pal[hi4];
+    uint8_t red1 = entry.r, green1 = entry.g, blue1 = entry.b;
+
+    if(lo4 && blendType != NOBLEND) {
+        const CRGB &next = (hi4 == 15) ? pal[0] : pal[hi4 + 1];
+        const uint8_t f2 = lo4 << 4;
+        const uint8_t f1 = 255 - f2;
+        red1 = scale8(red1, f1) + scale8(next.r, f2);
+        green1 = scale8(green1, f1) + scale8(next.g, f2);
+        blue1 = scale8(blue1, f1) + scale8(next.b, f2);
+    }
+
+    if(brightness != 255) {
+        if(brightness) {
+            brightness++;
+            red1 = red1 ? scale8(red1, brightness) + 1 : 0;
+            green1 = green1 ? scale8(green1, brightness) + 1 : 0;
+            blue1 = blue1 ? scale8(blue1, brightness) + 1 : 0;
+        } else {
+            red1 = green1 = blue1 = 0;
+        }
+    }
+    return CRGB(red1, green1, blue1);
+}
+
+extern const TProgmemRGBPalette16 RainbowColors_p FL_PROGMEM;
+extern const TProgmemRGBPalette16 PartyColors_p FL_PROGMEM;
+extern const TProgmemRGBPalette16 OceanColors_p FL_PROGMEM;
+extern const TProgmemRGBPalette16 ForestColors_p FL_PROGMEM;
+
+enum LEDColorCorrection : uint32_t { TypicalSMD5050 = 0xFFB0F0, UncorrectedColor = 0xFFFFFF };
+enum ColorTemperature : uint32_t { DirectSunlight = 0xFFFFFF, UncorrectedTemperature = 0xFFFFFF };
+
+enum ESPIChipsets { WS2812B };
+enum EOrder { RGB = 0012, GRB = 0102 };
+
+class CLEDController {
+public:
+    CLEDController &setCorrection(uint32_t) { return *this; }
+    CLEDController &setTemperature(uint32_t) { return *this; }
+    CLEDController &setDither(uint8_t) { return *this; }
+};
+
+// the "transmitted" frame is kept so simulations can inspect what would be visible on the clock face
+class CFastLED {
+public:
+    template <ESPIChipsets CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER> CLEDController &addLeds(CRGB *data, int nLeds) {
+        ledData = data;
+        ledCount = nLeds;
+        return controller;
+    }
+
+    void show() { show(brightness); }
+    void show(uint8_t scale);
+    void clear(bool writeData = false);
+
+    void setBrightness(uint8_t scale) { brightness = scale; }
+    uint8_t getBrightness() const { return brightness; }
+    void setDither(uint8_t ditherMode) { dither = ditherMode; }
+
+    int size() const { return ledCount; }
+    CRGB *leds() { return ledData; }
+
+    // simulation helpers
+    uint32_t getShowCount() const { return showCount; }
+    const CRGB *getShownFrame() const { return shown; }
+
+private:
+    CLEDController controller;
+    CRGB *ledData{nullptr};
+    int ledCount{0};
+    uint8_t brightness{255};
+    uint8_t dither{1};
+    uint32_t showCount{0};
+    CRGB shown[256]{};
+};
+extern CFastLED FastLED;
+
+inline uint32_t getFastLEDMillis() { return millis(); }
+
+template <uint32_t (*TimeGetter)()> class CEveryNTimePeriods {
+public:
+    CEveryNTimePeriods() : period(1) { reset(); }
+    CEveryNTimePeriods(uint32_t p) : period(p) { reset(); }
+
+    uint32_t getTime() { return TimeGetter(); }
+    uint32_t getPeriod() { return period; }
+    uint32_t getElapsed() { return getTime() - prevTrigger; }
+    uint32_t getRemaining() { return period - getElapsed(); }
+    uint32_t getLastTriggerTime() { return prevTrigger; }
+    void setPeriod(uint32_t p) { period = p; }
+
+    bool ready() {
+        const bool isReady = getElapsed() >= period;
+        if(isReady)
+            reset();
+        return isReady;
+    }
+    void reset() { prevTrigger = getTime(); }
+    void trigger() { prevTrigger = getTime() - period; }
+
+    operator bool() { return ready(); }
+
+private:
+    uint32_t prevTrigger;
+    uint32_t period;
+};
+
+namespace fl_timers {
+inline uint32_t millisTime() { return getFastLEDMillis(); }
+inline uint32_t secondsTime() { return getFastLEDMillis() / 1000; }
+inline uint32_t bsecondsTime() { return getFastLEDMillis() / 1024; }
+inline uint32_t minutesTime() { return getFastLEDMillis() / 60000; }
+inline uint32_t hoursTime() { return getFastLEDMillis() / 3600000; }
+} // namespace fl_timers
+
+using CEveryNMillis = CEveryNTimePeriods<fl_timers::millisTime>;
+using CEveryNSeconds = CEveryNTimePeriods<fl_timers::secondsTime>;
+using CEveryNBSeconds = CEveryNTimePeriods<fl_timers::bsecondsTime>;
+using CEveryNMinutes = CEveryNTimePeriods<fl_timers::minutesTime>;
+using CEveryNHours = CEveryNTimePeriods<fl_timers::hoursTime>;
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "WString.h"
+
+class Print {
+public:
+    virtual ~Print() = default;
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while(size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char *str) { return str ? write(reinterpret_cast<const uint8_t *>(str), strlen(str)) : 0; }
+    size_t write(const char *buffer, size_t size) { return write(reinterpret_cast<const uint8_t *>(buffer), size); }
+
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() { }
+
+    size_t print(const char *str) { return write(str); }
+    size_t print(const String &str) { return write(str.c_str()); }
+    size_t print(const __FlashStringHelper *str) { return write(reinterpret_cast<const char *>(str)); }
+    size_t print(char c) { return write(uint8_t(c)); }
+    size_t print(long value) { return printf("%ld", value); }
+    size_t print(unsigned long value) { return printf("%lu", value); }
+    size_t print(int value) { return printf("%d", value); }
+    size_t print(unsigned int value) { return printf("%u", value); }
+    size_t print(double value, int digits = 2) { return printf("%.*f", digits, value); }
+
+    template <typename T> size_t println(const T &value) { return print(value) + println(); }
+    size_t println() { return write("\r\n"); }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list arg;
+        va_start(arg, format);
+        const int len = vsnprintf(buf, sizeof(buf), format, arg);
+        va_end(arg);
+        return write(reinterpret_cast<const uint8_t *>(buf), std::min<size_t>(len, sizeof(buf) - 1));
+    }
+    size_t printf_P(PGM_P format, ...) {
+        char buf[256];
+        va_list arg;
+        va_start(arg, format);
+        const int len = vsnprintf(buf, sizeof(buf), format, arg);
+        va_end(arg);
+        return write(reinterpret_cast<const uint8_t *>(buf), std::min<size_t>(len, sizeof(buf) - 1));
+    }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(char *buffer, size_t length) {
+        size_t count = 0;
+        while(count < length) {
+            const int c = read();
+            if(c < 0)
+                break;
+            *buffer++ = char(c);
+            count++;
+        }
+        return count;
+    }
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes(reinterpret_cast<char *>(buffer), length); }
+
+    void setTimeout(unsigned long) { }
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+// host stand-in for RTCMemory, the data lives in RAM and is lost on exit like on a power cycle
+
+template <typename T> class RTCMemory {
+public:
+    bool begin() {
+        data = T{};
+        return false;
+    }
+    bool save() { return true; }
+    bool persist() { return true; }
+    T *getData() { return &data; }
+
+private:
+    T data{};
+};
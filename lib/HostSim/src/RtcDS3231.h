@@ -0,0 +1,116 @@
+#pragma once
+
+// host stand-in for the DS3231 driver of the Rtc library by Makuna
+// the simulated RTC runs off the simulation clock, it keeps its own offset so it can drift from the system time
+
+#include <Arduino.h>
+
+#include "RtcDateTime.h"
+
+enum DS3231SquareWavePinMode {
+    DS3231SquareWavePin_ModeNone,
+    DS3231SquareWavePin_ModeBatteryBackup,
+    DS3231SquareWavePin_ModeClock,
+    DS3231SquareWavePin_ModeAlarmOne,
+    DS3231SquareWavePin_ModeAlarmTwo,
+    DS3231SquareWavePin_ModeAlarmBoth
+};
+
+enum DS3231AlarmOneControl {
+    DS3231AlarmOneControl_HoursMinutesSecondsDayOfMonthMatch = 0x00,
+    DS3231AlarmOneControl_OncePerSecond = 0x17,
+    DS3231AlarmOneControl_SecondsMatch = 0x16,
+    DS3231AlarmOneControl_MinutesSecondsMatch = 0x14,
+    DS3231AlarmOneControl_HoursMinutesSecondsMatch = 0x10,
+    DS3231AlarmOneControl_HoursMinutesSecondsDayOfWeekMatch = 0x08,
+};
+
+enum DS3231AlarmTwoControl {
+    DS3231AlarmTwoControl_HoursMinutesDayOfMonthMatch = 0x00,
+    DS3231AlarmTwoControl_OncePerMinute = 0x0b,
+    DS3231AlarmTwoControl_MinutesMatch = 0x0a,
+    DS3231AlarmTwoControl_HoursMinutesMatch = 0x08,
+    DS3231AlarmTwoControl_HoursMinutesDayOfWeekMatch = 0x04,
+};
+
+enum DS3231AlarmFlag {
+    DS3231AlarmFlag_Alarm1 = 0x01,
+    DS3231AlarmFlag_Alarm2 = 0x02,
+    DS3231AlarmFlag_AlarmBoth = 0x03,
+};
+
+class DS3231AlarmOne {
+public:
+    DS3231AlarmOne(uint8_t dayOf, uint8_t hour, uint8_t minute, uint8_t second, DS3231AlarmOneControl controlFlags)
+        : _flags(controlFlags), _dayOf(dayOf), _hour(hour), _minute(minute), _second(second) { }
+
+    uint8_t DayOf() const { return _dayOf; }
+    uint8_t Hour() const { return _hour; }
+    uint8_t Minute() const { return _minute; }
+    uint8_t Second() const { return _second; }
+    DS3231AlarmOneControl ControlFlags() const { return _flags; }
+
+private:
+    DS3231AlarmOneControl _flags;
+    uint8_t _dayOf, _hour, _minute, _second;
+};
+
+class DS3231AlarmTwo {
+public:
+    DS3231AlarmTwo(uint8_t dayOf, uint8_t hour, uint8_t minute, DS3231AlarmTwoControl controlFlags)
+        : _flags(controlFlags), _dayOf(dayOf), _hour(hour), _minute(minute) { }
+
+    uint8_t DayOf() const { return _dayOf; }
+    uint8_t Hour() const { return _hour; }
+    uint8_t Minute() const { return _minute; }
+    DS3231AlarmTwoControl ControlFlags() const { return _flags; }
+
+private:
+    DS3231AlarmTwoControl _flags;
+    uint8_t _dayOf, _hour, _minute;
+};
+
+template <class T_WIRE_METHOD> class RtcDS3231 {
+public:
+    RtcDS3231(T_WIRE_METHOD &) { }
+
+    void Begin() { }
+    void Begin(int, int) { }
+    uint8_t LastError() { return 0; }
+
+    bool IsDateTimeValid() { return valid; }
+    bool GetIsRunning() { return running; }
+    void SetIsRunning(bool isRunning) { running = isRunning; }
+
+    void SetDateTime(const RtcDateTime &dt) {
+        offset = time_t(dt.Epoch32Time()) - sim::epoch();
+        valid = true;
+    }
+    RtcDateTime GetDateTime() {
+        RtcDateTime dt;
+        dt.InitWithEpoch32Time(sim::epoch() + offset);
+        return dt;
+    }
+
+    void Enable32kHzPin(bool) { }
+    void SetSquareWavePin(DS3231SquareWavePinMode pinMode, bool = true) { squareWave = pinMode; }
+
+    void SetAlarmOne(const DS3231AlarmOne &alarm) { alarmOne = alarm; }
+    void SetAlarmTwo(const DS3231AlarmTwo &alarm) { alarmTwo = alarm; }
+    DS3231AlarmOne GetAlarmOne() { return alarmOne; }
+    DS3231AlarmTwo GetAlarmTwo() { return alarmTwo; }
+
+    DS3231AlarmFlag LatchAlarmsTriggeredFlags() { return DS3231AlarmFlag(0); }
+
+    // simulation helpers
+    DS3231SquareWavePinMode getSquareWavePin() const { return squareWave; }
+    void setValid(bool isValid) { valid = isValid; }
+
+private:
+    bool valid{true};
+    bool running{true};
+    time_t offset{0};
+    DS3231SquareWavePinMode squareWave{DS3231SquareWavePin_ModeNone};
+    DS3231AlarmOne alarmOne{0, 0, 0, 0, DS3231AlarmOneControl_OncePerSecond};
+    DS3231AlarmTwo alarmTwo{0, 0, 0, DS3231AlarmTwoControl_OncePerMinute};
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+
+// host stand-in for the RtcDateTime of the Rtc library by Makuna, stored as unix time
+class RtcDateTime {
+public:
+    RtcDateTime() = default;
+    RtcDateTime(uint16_t year, uint8_t month, uint8_t dayOfMonth, uint8_t hour, uint8_t minute, uint8_t second) {
+        struct tm tm = {};
+        tm.tm_year = year - 1900;
+        tm.tm_mon = month - 1;
+        tm.tm_mday = dayOfMonth;
+        tm.tm_hour = hour;
+        tm.tm_min = minute;
+        tm.tm_sec = second;
+        epoch = timegm(&tm);
+    }
+
+    void InitWithEpoch32Time(time_t time) { epoch = time; }
+    uint32_t Epoch32Time() const { return uint32_t(epoch); }
+    uint64_t Epoch64Time() const { return uint64_t(epoch); }
+
+    uint16_t Year() const { return split().tm_year + 1900; }
+    uint8_t Month() const { return split().tm_mon + 1; }
+    uint8_t Day() const { return split().tm_mday; }
+    uint8_t Hour() const { return split().tm_hour; }
+    uint8_t Minute() const { return split().tm_min; }
+    uint8_t Second() const { return split().tm_sec; }
+    uint8_t DayOfWeek() const { return split().tm_wday; }
+
+    bool IsValid() const { return epoch > 946684800; }
+
+    void operator+=(int32_t seconds) { epoch += seconds; }
+    void operator-=(int32_t seconds) { epoch -= seconds; }
+
+private:
+    struct tm split() const {
+        struct tm tm;
+        gmtime_r(&epoch, &tm);
+        return tm;
+    }
+
+    time_t epoch{946684800};
+};
@@ -0,0 +1,7 @@
+#pragma once
+
+#include <functional>
+
+// scheduled functions run on the next call of run_scheduled_functions(), like after loop() on the ESP8266
+bool schedule_function(const std::function<void(void)> &fn);
+void run_scheduled_functions();
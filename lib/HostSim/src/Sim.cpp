@@ -0,0 +1,89 @@
+#include <Arduino.h>
+#include <deque>
+
+#include "Sim.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+namespace sim {
+
+namespace {
+uint64_t clockMicros = 0;
+time_t epochOffset = 1672531200; // 2023-01-01 00:00:00 UTC
+
+uint8_t pinLevels[32];
+bool pinsInitialized = false;
+
+std::deque<char> serialBuffer;
+
+void initPins() {
+    if(pinsInitialized)
+        return;
+    // everything is pulled up, no button pressed and no RTC alarm pending
+    for(auto &p : pinLevels)
+        p = HIGH;
+    pinsInitialized = true;
+}
+} // namespace
+
+uint64_t nowMicros() { return clockMicros; }
+
+void advanceMicros(uint64_t us) { clockMicros += us; }
+
+void setEpoch(time_t e) { epochOffset = e - time_t(clockMicros / 1000000); }
+
+time_t epoch() { return epochOffset + time_t(clockMicros / 1000000); }
+
+void pinMode(uint8_t, uint8_t) { initPins(); }
+
+int digitalRead(uint8_t pin) {
+    initPins();
+    return pin < 32 ? pinLevels[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) { setPin(pin, value); }
+
+void setPin(uint8_t pin, int level) {
+    initPins();
+    if(pin < 32)
+        pinLevels[pin] = level;
+}
+
+void serialInput(const char *str) {
+    while(*str)
+        serialBuffer.push_back(*str++);
+}
+
+int serialAvailable() { return serialBuffer.size(); }
+
+int serialRead() {
+    if(serialBuffer.empty())
+        return -1;
+    const int c = serialBuffer.front();
+    serialBuffer.pop_front();
+    return c;
+}
+
+int serialPeek() { return serialBuffer.empty() ? -1 : serialBuffer.front(); }
+
+} // namespace sim
+
+// the wall clock of the simulation replaces the one from the C library
+extern "C" time_t time(time_t *t) {
+    const time_t now = sim::epoch();
+    if(t)
+        *t = now;
+    return now;
+}
+
+extern "C" int gettimeofday(struct timeval *tv, void *) {
+    tv->tv_sec = sim::epoch();
+    tv->tv_usec = sim::nowMicros() % 1000000;
+    return 0;
+}
+
+extern "C" int settimeofday(const struct timeval *tv, const struct timezone *) {
+    sim::setEpoch(tv->tv_sec);
+    return 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+// simulated time, pins and serial input for the host build
+// all of the clock's notion of time (millis(), time(), the RTC) is derived from one simulated clock,
+// so a simulation can run many days of wall time in a fraction of a second
+
+#include <cstdint>
+#include <ctime>
+
+namespace sim {
+
+uint64_t nowMicros();
+inline unsigned long millis() { return nowMicros() / 1000; }
+inline unsigned long micros() { return nowMicros(); }
+
+void advanceMicros(uint64_t us);
+inline void advanceMillis(uint64_t ms) { advanceMicros(ms * 1000); }
+inline void advanceSeconds(uint64_t s) { advanceMicros(s * 1000000); }
+
+// sets the wall clock (UTC) returned by time() and the RTC
+void setEpoch(time_t epoch);
+time_t epoch();
+
+// cycle counter at the simulated 160 MHz
+inline uint32_t cycleCount() { return uint32_t(nowMicros() * 160); }
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+// simulate an external level on an input pin
+void setPin(uint8_t pin, int level);
+
+void serialInput(const char *str);
+int serialAvailable();
+int serialRead();
+int serialPeek();
+
+} // namespace sim
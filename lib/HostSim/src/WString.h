@@ -0,0 +1,93 @@
+#pragma once
+
+// host stand-in for the Arduino String class, backed by std::string
+
+#include <cstdlib>
+#include <string>
+
+#include "pgmspace.h"
+
+class __FlashStringHelper;
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper *>(pstr_pointer))
+#define F(string_literal) (FPSTR(PSTR(string_literal)))
+
+class String {
+public:
+    String() = default;
+    String(const char *str) : s(str ? str : "") { }
+    String(const __FlashStringHelper *str) : s(reinterpret_cast<const char *>(str)) { }
+    String(const std::string &str) : s(str) { }
+    explicit String(char c) : s(1, c) { }
+    explicit String(int value) : s(std::to_string(value)) { }
+    explicit String(unsigned int value) : s(std::to_string(value)) { }
+    explicit String(long value) : s(std::to_string(value)) { }
+    explicit String(unsigned long value) : s(std::to_string(value)) { }
+
+    const char *c_str() const { return s.c_str(); }
+    unsigned int length() const { return s.length(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size) {
+        s.reserve(size);
+        return true;
+    }
+
+    char operator[](unsigned int index) const { return s[index]; }
+    char &operator[](unsigned int index) { return s[index]; }
+
+    bool concat(const char *str) {
+        s += str;
+        return true;
+    }
+    bool concat(const char *str, unsigned int len) {
+        s.append(str, len);
+        return true;
+    }
+    bool concat(char c) {
+        s += c;
+        return true;
+    }
+
+    String &operator+=(const String &rhs) {
+        s += rhs.s;
+        return *this;
+    }
+    String &operator+=(const char *rhs) {
+        s += rhs;
+        return *this;
+    }
+    String &operator+=(const __FlashStringHelper *rhs) {
+        s += reinterpret_cast<const char *>(rhs);
+        return *this;
+    }
+    String &operator+=(char rhs) {
+        s += rhs;
+        return *this;
+    }
+
+    friend String operator+(const String &lhs, const String &rhs) { return String(lhs.s + rhs.s); }
+    friend String operator+(const String &lhs, const char *rhs) { return String(lhs.s + rhs); }
+    friend String operator+(const __FlashStringHelper *lhs, const String &rhs) { return String(lhs) + rhs; }
+
+    bool operator==(const String &rhs) const { return s == rhs.s; }
+    bool operator==(const char *rhs) const { return s == rhs; }
+    bool operator!=(const String &rhs) const { return s != rhs.s; }
+
+    void replace(const String &find, const String &replace) {
+        if(find.s.empty())
+            return;
+        for(size_t pos = s.find(find.s); pos != std::string::npos; pos = s.find(find.s, pos + replace.s.size()))
+            s.replace(pos, find.s.size(), replace.s);
+    }
+
+    long toInt() const { return std::strtol(s.c_str(), nullptr, 10); }
+
+    int indexOf(char c) const {
+        const auto pos = s.find(c);
+        return pos == std::string::npos ? -1 : int(pos);
+    }
+    String substring(unsigned int left, unsigned int right) const { return String(s.substr(left, right - left)); }
+    String substring(unsigned int left) const { return String(s.substr(left)); }
+
+private:
+    std::string s;
+};
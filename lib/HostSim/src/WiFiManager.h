@@ -0,0 +1,10 @@
+#pragma once
+
+#include <Arduino.h>
+
+// the host build has no radio, the portal is never started
+class WiFiManager {
+public:
+    bool getConfigPortalActive() { return false; }
+    void process() { }
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+using TrivialCB = std::function<void()>;
+using BoolCB = std::function<void(bool)>;
+
+void settimeofday_cb(const BoolCB &cb);
+void settimeofday_cb(const TrivialCB &cb);
+
+uint32_t crc32(const void *data, size_t length, uint32_t crc = 0xffffffff);
@@ -0,0 +1,5 @@
+#pragma once
+
+// the host build has no SNTP client
+inline void sntp_init() { }
+inline void sntp_stop() { }
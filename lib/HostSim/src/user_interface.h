@@ -0,0 +1,11 @@
+#pragma once
+
+// host stand-in for the SDK's user_interface.h
+
+#include <cstdint>
+
+#include "Sim.h"
+
+// the RTC timer keeps counting through light sleep, the SDK calibrates its period (µs per tick, Q12 fixed point)
+inline uint32_t system_get_rtc_time() { return uint32_t(sim::nowMicros() * 4 / 25); }
+inline uint32_t system_rtc_clock_cali_proc() { return 25 << 12 >> 2; } // 6.25 µs
@@ -0,0 +1,26 @@
+# PlatformIO extra script of the release and native-bench environments, see platformio.ini
+Import("env")
+
+# the per-frame code is worth the extra flash of -O2, everything else stays at -Os
+HOT_MODULES = ["*/src/WordClock.cpp"]
+
+
+def optimize_hot(env, node):
+  return env.Object(node, CCFLAGS=env["CCFLAGS"] + ["-O2"])
+
+
+for pattern in HOT_MODULES:
+  env.AddBuildMiddleware(optimize_hot, pattern)
+
+# no LTO: the linker script of the core places code in IRAM or flash by the name of its object file,
+# the objects LTO creates at link time match none of these patterns
+
+# pio run -e release -t size_report, the toolchain is only known when the target runs
+if env["PIOPLATFORM"] == "espressif8266":
+  env.AddCustomTarget(
+    name="size_report",
+    dependencies="$BUILD_DIR/${PROGNAME}.elf",
+    actions='"$PYTHONEXE" "$PROJECT_DIR/scripts/size_report.py" --cc "$CC" --src "$PROJECT_SRC_DIR" "$BUILD_DIR/${PROGNAME}.elf"',
+    title="Size report",
+    description="flash, IRAM and RAM per module, checked against the limits of the ESP8266",
+  )
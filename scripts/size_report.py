@@ -0,0 +1,114 @@
+import argparse
+import os
+import subprocess
+import sys
+from collections import defaultdict
+
+# a module is a file of src/ (WordClock.cpp, Fader.h, ...), a library or the framework
+# ram is static RAM (data, bss and rodata outside PROGMEM), every byte of it is missing from the heap
+
+# constexpr tables often come without a source location, they are assigned by name
+NAME_MODULES = {
+  "data::timezone": "genTimezone",
+  "timezonesJson": "genTimezoneJson",
+  "LangGer::": "lang_ger",
+  "LangEng::": "lang_eng",
+}
+
+# whole firmware: 1 MB sketch space of eagle.flash.4m1m.ld, 32 kB IRAM, heap left of the 80 kB DRAM
+TOTAL_FLASH = 1024 * 1024 - 4096
+TOTAL_IRAM = 32 * 1024
+DRAM = 80 * 1024
+MIN_FREE_HEAP = 32 * 1024
+
+
+def region(address):
+  # ESP8266 memory map
+  if 0x40100000 <= address < 0x40110000:
+    return "iram"
+  if address >= 0x40200000:
+    return "flash"
+  if 0x3FFE8000 <= address < 0x40000000:
+    return "ram"
+  return None
+
+
+def module(path, src, name):
+  if not path:
+    for prefix, mod in NAME_MODULES.items():
+      if name.startswith(prefix):
+        return mod
+    return "(no debug info)"
+  path = os.path.normpath(path)
+  if src and path.startswith(src + os.sep):
+    return os.path.splitext(os.path.basename(path))[0]
+  parts = path.split(os.sep)
+  if "libdeps" in parts:
+    # .pio/libdeps/<env>/<library>/...
+    i = parts.index("libdeps")
+    return "lib:" + parts[i + 2] if len(parts) > i + 2 else "lib"
+  return "(framework)"
+
+
+def load_symbols(nm, elf, src):
+  out = subprocess.run([nm, "-S", "-l", "-C", "--defined-only", elf], capture_output=True, text=True, check=True).stdout
+
+  symbols = []
+  for line in out.splitlines():
+    head, _, location = line.partition("\t")
+    fields = head.split(None, 3)
+    if len(fields) < 4:
+      continue  # no size
+    address, size, _, name = fields
+    r = region(int(address, 16))
+    if r:
+      path = location.rsplit(":", 1)[0] if location else None
+      symbols.append((module(path, src, name), r, int(size, 16), name))
+  return symbols
+
+
+def main():
+  parser = argparse.ArgumentParser(description="flash/IRAM/RAM per module of the firmware, checked against the limits of the chip")
+  parser.add_argument("elf")
+  parser.add_argument("--nm", help="nm of the toolchain, derived from --cc if missing")
+  parser.add_argument("--cc", default="xtensa-lx106-elf-gcc")
+  parser.add_argument("--src", default="src", help="source directory, its files are reported one by one")
+  parser.add_argument("--top", type=int, default=10, help="largest symbols to list")
+  args = parser.parse_args()
+
+  nm = args.nm or args.cc.replace("gcc", "nm")
+  symbols = load_symbols(nm, args.elf, os.path.normpath(os.path.abspath(args.src)))
+
+  sizes = defaultdict(lambda: defaultdict(int))
+  totals = defaultdict(int)
+  for mod, r, size, _ in symbols:
+    sizes[mod][r] += size
+    totals[r] += size
+
+  failed = []
+  print(f"{'module':<24} {'flash':>8} {'iram':>8} {'ram':>8}")
+  for mod in sorted(sizes, key=lambda m: -sum(sizes[m].values())):
+    row = sizes[mod]
+    print(f"{mod:<24} {row['flash']:>8} {row['iram']:>8} {row['ram']:>8}")
+
+  free_heap = DRAM - totals["ram"]
+  print(f"{'total':<24} {totals['flash']:>8} {totals['iram']:>8} {totals['ram']:>8}")
+  print(f"heap left at boot ~{free_heap} bytes")
+  if totals["flash"] > TOTAL_FLASH:
+    failed.append(f"flash: {totals['flash']} > {TOTAL_FLASH}")
+  if totals["iram"] > TOTAL_IRAM:
+    failed.append(f"iram: {totals['iram']} > {TOTAL_IRAM}")
+  if free_heap < MIN_FREE_HEAP:
+    failed.append(f"heap: {free_heap} < {MIN_FREE_HEAP}")
+
+  if args.top:
+    print("\nlargest symbols")
+    for mod, r, size, name in sorted(symbols, key=lambda s: -s[2])[:args.top]:
+      print(f"{size:>8} {r:<5} {mod:<16} {name}")
+
+  if failed:
+    print("\nover the limit:\n  " + "\n  ".join(failed))
+    sys.exit(1)
+
+
+main()
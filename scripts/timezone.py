@@ -1,85 +1,157 @@
-import requests
 import csv
+import gzip
+import hashlib
 import io
-import re
+import json
+import sys
 
 URL = "https://raw.githubusercontent.com/nayarsystems/posix_tz_db/master/zones.csv"
-namekey_regex = r"[\W]"
-codekey_regex = r"([-])|([+])|([\W])"
-
-def gencodekey(match):
-  if match.group(1) is not None:
-    return "m"
-  if match.group(2) is not None:
-    return "p"
-  if match.group(3) is not None:
-    return "_"
-
-response = requests.get(URL)
-data = response.content
-memory_file = io.StringIO(data.decode('utf8'))
-csv_reader = csv.reader(memory_file, delimiter=',')
-
-tz_name = dict()
-tz_code = dict()
-timezones = dict()
-
-for row in csv_reader:
-    name = row[0]
-    keyn = re.sub(namekey_regex, "_", name)
-    tz_name[keyn] = name
-
-    code = row[1]
-    keyc = re.sub(codekey_regex, gencodekey, code)
-    tz_code[keyc] = code
-
-    timezones[keyn] = keyc
-
-f = open("../src/genTimezone.h", "w")
-f.write("""/*
- * autogenerated code by timezones.py
+
+# names in the order of the index based table, settings record version < 3 and JSON documents with a numeric timezone use it
+LEGACY = "timezones_v2.txt"
+
+
+def load_zones(path=None):
+  if path:
+    data = open(path, encoding="utf8").read()
+  else:
+    import requests
+    data = requests.get(URL).content.decode("utf8")
+
+  zones = dict()
+  for row in csv.reader(io.StringIO(data), delimiter=','):
+    zones[row[0]] = row[1]
+  return zones
+
+
+def write_table(zones, legacy):
+  names = sorted(zones.keys())
+
+  # the names followed by the distinct rules, all in one pool addressed by offsets
+  pool = []
+  offsets = dict()
+  size = 0
+  for s in names + sorted(set(zones.values())):
+    if s in offsets:
+      continue
+    offsets[s] = size
+    pool.append(s)
+    size += len(s) + 1
+  assert size < 65536
+
+  index = {n: i for i, n in enumerate(names)}
+  fallback = index["Etc/UTC"]
+
+  f = open("../include/genTimezone.h", "w")
+  f.write("""#pragma once
+/*
+ * autogenerated code by timezone.py
  */
 
 #include <Arduino.h>
+#include <string_view>
 
+// the tables are inline, the firmware holds one copy no matter how many files include this header
 namespace data {
 
-// timezone names
+// the names in sorted order followed by the distinct POSIX rules, every string is terminated by \\0
+inline constexpr const char timezonePool[] PROGMEM =
 """)
+  for s in pool:
+    f.write(f"    \"{s}\\0\"\n")
+  f.write("""    ;
 
-for k,v in tz_name.items():
-    f.write(f"constexpr const char {k}[] PROGMEM = \"{v}\";\n")
+struct TimezoneEntry {
+    uint16_t name; // offsets into timezonePool
+    uint16_t rule;
+};
 
-f.write("""
+// sorted by name
+inline constexpr TimezoneEntry timezoneTable[] PROGMEM = {
+""")
+  for n in names:
+    f.write(f"    {{{offsets[n]}, {offsets[zones[n]]}}}, // {n}\n")
+  f.write("""};
 
-// timezone codes
+// index of the legacy table -> index of timezoneTable
+inline constexpr uint16_t timezoneLegacyIndex[] PROGMEM = {
 """)
-for k,v in tz_code.items():
-    f.write(f"constexpr const char {k}[] PROGMEM = \"{v}\";\n")
+  for n in legacy:
+    f.write(f"    {index.get(n, fallback)}, // {n}\n")
+  f.write("};\n\n} // namespace data\n\n")
+
+  f.write(f"constexpr size_t timezoneSize = {len(names)};\n")
+  f.write(f"constexpr size_t timezoneLegacySize = {len(legacy)};\n")
+  f.write("""
+// index of an IANA name, timezoneSize if it is unknown
+// for compile time constants only, at run time the pool has to be read with the _P functions (see findTimezone())
+constexpr size_t timezoneIndex(std::string_view name) {
+    size_t lo = 0;
+    size_t hi = timezoneSize;
+    while(lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        const std::string_view entry(data::timezonePool + data::timezoneTable[mid].name);
+        if(entry == name)
+            return mid;
+        if(entry < name)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return timezoneSize;
+}
+
+// binary search in flash, timezoneSize if the name is unknown
+inline size_t findTimezone(const char *name) {
+    size_t lo = 0;
+    size_t hi = timezoneSize;
+    while(lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        const int cmp = strcmp_P(name, data::timezonePool + pgm_read_word(&data::timezoneTable[mid].name));
+        if(cmp == 0)
+            return mid;
+        if(cmp > 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return timezoneSize;
+}
+
+inline PGM_P timezoneName(size_t i) { return data::timezonePool + pgm_read_word(&data::timezoneTable[i].name); }
+inline PGM_P timezoneRule(size_t i) { return data::timezonePool + pgm_read_word(&data::timezoneTable[i].rule); }
+inline size_t timezoneFromLegacy(size_t i) { return i < timezoneLegacySize ? pgm_read_word(&data::timezoneLegacyIndex[i]) : timezoneSize; }
+""")
+  f.close()
+  return names
 
-f.write("""
 
-} // namespace data
+def write_catalogue(names):
+  # gzip compressed JSON array of the names in table order, the setup page loads it from flash as is
+  catalogue = json.dumps(names, separators=(",", ":")).encode()
+  blob = gzip.compress(catalogue, compresslevel=9, mtime=0)
 
-// timezones mapping table
-constexpr const char *timezones[][2] PROGMEM = {
-""")
-for k,v in timezones.items():
-    f.write(f"{{ data::{k}, data::{v} }},\n")
-f.write("};\n")
-
-f.write(f"constexpr size_t timezoneSize = {len(timezones)};")
+  f = open("../include/genTimezoneJson.h", "w")
+  f.write("""#pragma once
+/*
+ * autogenerated code by timezone.py
+ */
 
-f.write("""
+#include <Arduino.h>
 
-//timezone enum
-enum TZ_Names : size_t {
 """)
-counter = 0
-for k in timezones.keys():
-    if counter == 0:
-      f.write(f"TZ_{k} = 0,\n")
-    else:
-      f.write(f"TZ_{k},\n")
-    counter += 1
-f.write("};")
\ No newline at end of file
+  f.write(f"// changes with the content, the page asks for /timezones.json?v=<version> so the browser may cache it forever\n")
+  f.write(f"constexpr const char timezonesJsonVersion[] PROGMEM = \"{hashlib.sha1(catalogue).hexdigest()[:8]}\";\n\n")
+  f.write("// [\"Africa/Abidjan\",...] indexed like data::timezoneTable, gzip compressed\n")
+  f.write("constexpr const uint8_t timezonesJsonGz[] PROGMEM = {\n")
+  for i in range(0, len(blob), 16):
+    f.write(", ".join(f"0x{b:02x}" for b in blob[i:i + 16]) + ",\n")
+  f.write("};\n")
+  f.write(f"constexpr size_t timezonesJsonGzSize = {len(blob)};\n")
+  f.close()
+
+
+# usage: timezone.py [zones.csv], downloads the zones from posix_tz_db without a file
+zones = load_zones(sys.argv[1] if len(sys.argv) > 1 else None)
+legacy = open(LEGACY, encoding="utf8").read().split()
+write_catalogue(write_table(zones, legacy))
@@ -0,0 +1,133 @@
+#include <Arduino.h>
+#include <new>
+
+#include "Benchmark.h"
+#include "Settings.h"
+#include "WordClock.h"
+#include "esp-hal-log.h"
+
+#ifdef WORDCLOCK_BENCH
+
+#if defined(ARDUINO_HOST_SIM) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#elif defined(ARDUINO_HOST_SIM)
+#include <chrono>
+#endif
+
+namespace {
+
+uint32_t allocCount = 0;
+volatile uint32_t sink;
+
+// swallows the drained benchmark log records
+class NullPrint : public Print {
+public:
+    size_t write(uint8_t) override { return 1; }
+    size_t write(const uint8_t *, size_t size) override { return size; }
+};
+
+// CPU cycles on the ESP8266, TSC ticks (or nanoseconds) on the host
+inline uint64_t cycles() {
+#if defined(ARDUINO_HOST_SIM) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#elif defined(ARDUINO_HOST_SIM)
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return ESP.getCycleCount();
+#endif
+}
+
+} // namespace
+
+// the bench environments link with --wrap=malloc and --wrap=realloc, so every heap allocation is counted
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    allocCount++;
+    return __real_malloc(size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    allocCount++;
+    return __real_realloc(ptr, size);
+}
+}
+
+#ifdef ARDUINO_HOST_SIM
+// the C++ runtime of the host allocates behind the linker's back, route new through the wrapped malloc
+void *operator new(size_t size) {
+    void *p = malloc(size ? size : 1);
+    if(!p)
+        abort();
+    return p;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+#endif
+
+uint32_t Benchmark::allocations() { return allocCount; }
+
+void Benchmark::measure(Print &out, const char *name, uint32_t iterations, Func func) {
+    // warm up caches and lazily initialized state
+    func();
+
+    const uint32_t allocStart = allocCount;
+    // the 32 bit cycle counter of the ESP8266 wraps after 26 s at 160 MHz, keep the batches short
+    const uint64_t start = cycles();
+    for(uint32_t i = 0; i < iterations; i++)
+        func();
+    const uint32_t elapsed = cycles() - start;
+    const uint32_t allocs = allocCount - allocStart;
+
+    out.printf("BENCH {\"bench\":\"%s\",\"iterations\":%u,\"cycles_per_call\":%u,\"allocs_per_call\":%u.%02u}\r\n", name, iterations,
+               elapsed / iterations, allocs / iterations, (allocs * 100 / iterations) % 100);
+}
+
+void Benchmark::run(Print &out) {
+    static struct tm tm;
+    const time_t now = time(nullptr);
+    localtime_r(&now, &tm);
+
+    measure(out, "showTime", 1000, []() { wordClock.lang.showTime(&tm); });
+    // forget the last frame so every call colorizes and shows instead of taking the unchanged frame shortcut
+    measure(out, "colorOutput", 1000, []() {
+        wordClock.lastFrameHash = 0;
+        wordClock.colorOutput(false);
+    });
+    measure(out, "colorOutputNight", 1000, []() {
+        wordClock.lastFrameHash = 0;
+        wordClock.colorOutput(true);
+    });
+    measure(out, "paletteLutBuild", 20, []() { wordClock.palette.build(*data::colorPalettes[settings.palette]); });
+
+#ifdef NIGHTMODE
+    const bool nmAutomatic = settings.nmAutomatic;
+    settings.nmAutomatic = false;
+    measure(out, "isNightmode", 1000, []() { sink = wordClock.isNightmode(tm); });
+    settings.nmAutomatic = true;
+    measure(out, "isNightmodeAuto", 1000, []() { sink = wordClock.isNightmode(tm); });
+    settings.nmAutomatic = nmAutomatic;
+#endif
+
+    measure(out, "loadSettings", 20, []() { sink = settings.loadSettings(); });
+
+    // stays well below the capacity of the log buffer, independent of the compiled log level
+    NullPrint null;
+    log_drain(null);
+    measure(out, "logRecord", 20, []() {
+        log_record(ARDUHAL_LOG_LEVEL_DEBUG, PSTR("%02d:%02d %s"), __FILE__, __LINE__, __FUNCTION__, tm.tm_hour, tm.tm_min, "bench");
+    });
+    log_drain(null);
+
+    // leave the clock showing the time again
+    wordClock.lang.showTime(&tm);
+    wordClock.colorOutput(wordClock.isNightmode(tm));
+}
+
+#endif
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Micro benchmarks of the per-wake hot path, available with WORDCLOCK_BENCH defined.
+// Every result is printed as one line "BENCH {json}" so it can be grepped from the serial log or the simulator output.
+class Benchmark {
+public:
+    static void run(Print &out);
+
+    // number of heap allocations since boot
+    static uint32_t allocations();
+
+private:
+    using Func = void (*)();
+
+    static void measure(Print &out, const char *name, uint32_t iterations, Func func);
+};
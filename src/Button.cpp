@@ -1,3 +1,4 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_BUTTONS // see config.h
 
 #include <Arduino.h>
 #include <Schedule.h>
@@ -5,6 +6,7 @@
 #include <c++23.h>
 
 #include "Button.h"
+#include "config.h"
 #include "esp-hal-log.h"
 
 void Button::begin(uint8_t pin, bool activeLow, bool intPullup) {
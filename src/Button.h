@@ -21,6 +21,7 @@ public:
     bool releasedRaw() { return digitalRead(_pin) != _buttonPressed; }
 
     void armWakeup();
+    void disarmWakeup() { detachInterrupt(_pin); }
     bool isBusy() const { return _state != StateMachine::init; }
 
     void setDebounceMs(uint16_t ms) { _debounceTime = ms; }
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiManager.h>
+
+/**
+ * Print that streams a response with chunked transfer encoding, the content passes through a small fixed buffer.
+ * The response is finished by end() or the destructor.
+ */
+class ChunkedResponse : public Print {
+public:
+    ChunkedResponse(ESP8266WebServer &server, int code, const char *contentType) : server(server) {
+        server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+        server.send(code, contentType, "");
+    }
+    ~ChunkedResponse() { end(); }
+
+    size_t write(uint8_t c) override {
+        if(used == sizeof(buffer))
+            flush();
+        buffer[used++] = c;
+        return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t size) override {
+        for(size_t left = size; left;) {
+            if(used == sizeof(buffer))
+                flush();
+            const size_t n = std::min(left, sizeof(buffer) - used);
+            memcpy(buffer + used, data, n);
+            used += n;
+            data += n;
+            left -= n;
+        }
+        return size;
+    }
+
+    void flush() override {
+        if(!used)
+            return;
+        server.sendContent(buffer, used);
+        used = 0;
+    }
+
+    // sends the last chunk, an empty one terminates the response
+    void end() {
+        if(done)
+            return;
+        flush();
+        server.sendContent("");
+        done = true;
+    }
+
+private:
+    ESP8266WebServer &server;
+    char buffer[256];
+    size_t used{0};
+    bool done{false};
+};
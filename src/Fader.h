@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <algorithm>
+
+#include "Language.h"
+
+/**
+ * Cross-fades the LEDs that switch between lit and dark from the last shown frame to a new one.
+ * LEDs that stay lit (or dark) take the new color right away. All math is 8 bit fixed-point and the
+ * frames live in the object, so a transition never allocates. Frames are produced by step() whenever one
+ * is due, in between the caller is free to idle.
+ */
+template <size_t N> class Fader {
+public:
+    Fader() = default;
+
+    void setDuration(uint16_t ms) { duration = ms; }
+    void setFrameTime(uint16_t ms) { frameTime = ms; }
+
+    bool isActive() const { return active; }
+
+    // the frame that was last sent to the LEDs, the next transition starts from it
+    void shown(const CRGB *frame) {
+        if(!active)
+            std::copy(frame, frame + N, from);
+    }
+
+    // fade from the last shown frame to target, returns false if no LED changes between lit and dark
+    bool start(const CRGB *target, uint32_t now) {
+        // a new transition during a running one continues from what is visible right now
+        if(active)
+            blendFrame(from, progress(now));
+
+        std::copy(target, target + N, to);
+        changed = LedMask<N>{};
+        bool any = false;
+        for(size_t i = 0; i < N; i++) {
+            if(bool(from[i]) != bool(to[i])) {
+                changed.set(i, i);
+                any = true;
+            }
+        }
+
+        active = any && duration;
+        startTime = nextFrame = now;
+        return active;
+    }
+
+    // writes the next frame of the transition into leds, returns false if no frame is due
+    bool step(CRGB *leds, uint32_t now) {
+        if(!active || int32_t(now - nextFrame) < 0)
+            return false;
+
+        if(now - startTime >= duration) {
+            std::copy(to, to + N, leds);
+            active = false;
+        } else {
+            blendFrame(leds, progress(now));
+            nextFrame = now + frameTime;
+        }
+        return true;
+    }
+
+    // time until step() produces the next frame
+    uint32_t msUntilNextFrame(uint32_t now) const {
+        if(!active)
+            return 0;
+        const int32_t remaining = nextFrame - now;
+        return std::max<int32_t>(remaining, 0);
+    }
+
+private:
+    fract8 progress(uint32_t now) const {
+        const uint32_t elapsed = now - startTime;
+        return (elapsed >= duration) ? 255 : elapsed * 255 / duration;
+    }
+
+    void blendFrame(CRGB *out, fract8 amount) const {
+        for(size_t i = 0; i < N; i++)
+            out[i] = changed.test(i) ? blend(from[i], to[i], amount) : to[i];
+    }
+
+    CRGB from[N];
+    CRGB to[N];
+    LedMask<N> changed;
+
+    bool active{false};
+    uint16_t duration{0};
+    uint16_t frameTime{20};
+    uint32_t startTime{0};
+    uint32_t nextFrame{0};
+};
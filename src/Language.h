@@ -6,6 +6,37 @@
 
 #include "config.h"
 
+/**
+ * One bit per LED, packed into 32 bit words so a whole frame fits into a handful of words in flash
+ */
+template <size_t N> struct LedMask {
+    static constexpr size_t wordCount = (N + 31) / 32;
+    uint32_t bits[wordCount]{};
+
+    // mark the LEDs first to last (both inclusive)
+    constexpr void set(size_t first, size_t last) {
+        for(size_t i = first; i <= last && i < N; i++)
+            bits[i / 32] |= uint32_t(1) << (i % 32);
+    }
+
+    constexpr bool test(size_t i) const { return bits[i / 32] & (uint32_t(1) << (i % 32)); }
+
+    // calls f(i) for every marked LED, skipping the others a word at a time
+    template <typename F> void forEach(F f) const {
+        for(size_t w = 0; w < wordCount; w++)
+            for(uint32_t b = bits[w]; b; b &= b - 1)
+                f(w * 32 + __builtin_ctz(b));
+    }
+};
+
+// generates a table of masks at compile time, gen(i) returns the mask for the i-th entry
+template <size_t N, size_t Count, typename Gen> constexpr std::array<LedMask<N>, Count> makeMaskTable(Gen gen) {
+    std::array<LedMask<N>, Count> table{};
+    for(size_t i = 0; i < Count; i++)
+        table[i] = gen(i);
+    return table;
+}
+
 class Language {
 public:
     Language() = default;
@@ -21,12 +52,31 @@ public:
     virtual void showReset() = 0;
 
 protected:
+    static constexpr uint8_t minuteBuckets = 12;
+    static constexpr uint8_t hourSlots = 12;
+
+    // index into the time mask tables, hours 12, 1, ..., 11 map to slot 0 - 11
+    static constexpr size_t timeMaskIndex(uint8_t bucket, int hour12) { return bucket * hourSlots + hour12 % hourSlots; }
+
     const CHSV markerHSV{CHSV(128, 96, 1)};
 
     CRGB *leds;
     size_t size;
 
-    int hourFormat12(int hour) { // the hour for the given time in 12 hour format
+    // paints the LEDs marked in the mask (located in flash) and clears all others
+    template <size_t N> void showMask(const LedMask<N> *mask) {
+        LedMask<N> m;
+        memcpy_P(&m, mask, sizeof(m));
+
+        const CRGB marker = markerHSV;
+        for(size_t w = 0, i = 0; w < m.wordCount; w++) {
+            uint32_t bits = m.bits[w];
+            for(size_t b = 0; b < 32 && i < size; b++, i++, bits >>= 1)
+                leds[i] = (bits & 1) ? marker : CRGB(CRGB::Black);
+        }
+    }
+
+    static constexpr int hourFormat12(int hour) { // the hour for the given time in 12 hour format
         if(hour == 0)
             return 12; // 12 midnight
         else if(hour > 12)
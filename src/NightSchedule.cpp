@@ -0,0 +1,66 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_CLOCK // see config.h
+
+#include <Arduino.h>
+
+#include "NightSchedule.h"
+#include "Settings.h"
+#include "Solar.h"
+#include "esp-hal-log.h"
+
+NightSchedule::Key NightSchedule::Key::fromSettings(const struct tm &tm) {
+    return Key{tm.tm_year, tm.tm_yday, settings.timezone, settings.nmAutomatic, settings.nmStartTime, settings.nmEndTime, settings.latitude,
+               settings.longitude};
+}
+
+bool NightSchedule::Key::matches(const struct tm &tm) const {
+    return yday == tm.tm_yday && year == tm.tm_year && timezone == settings.timezone && automatic == settings.nmAutomatic
+        && start.hour == settings.nmStartTime.hour && start.minute == settings.nmStartTime.minute && end.hour == settings.nmEndTime.hour
+        && end.minute == settings.nmEndTime.minute && latitude == settings.latitude && longitude == settings.longitude;
+}
+
+int NightSchedule::utcOffsetMinutes(const struct tm &tm) {
+    // local noon of the given day, so a DST switch in the early morning is already applied
+    struct tm local = tm;
+    local.tm_hour = 12;
+    local.tm_min = 0;
+    local.tm_sec = 0;
+    local.tm_isdst = -1;
+    const time_t t = mktime(&local);
+
+    struct tm utc;
+    gmtime_r(&t, &utc);
+
+    int offset = (local.tm_hour - utc.tm_hour) * 60 + (local.tm_min - utc.tm_min);
+    if(local.tm_yday != utc.tm_yday) {
+        const bool localAhead = (local.tm_year != utc.tm_year) ? local.tm_year > utc.tm_year : local.tm_yday > utc.tm_yday;
+        offset += localAhead ? 24 * 60 : -24 * 60;
+    }
+    return offset;
+}
+
+void NightSchedule::update(const struct tm &tm) {
+    key = Key::fromSettings(tm);
+    valid = true;
+
+    if(!settings.nmAutomatic) {
+        startMinute = settings.nmStartTime.hour * 60 + settings.nmStartTime.minute;
+        endMinute = settings.nmEndTime.hour * 60 + settings.nmEndTime.minute;
+    } else {
+        // night mode lasts from sunset to sunrise
+        const solar::SunTimes sun = solar::sunTimes(tm.tm_yday, settings.latitude, settings.longitude);
+        constexpr int day = 24 * 60;
+
+        if(sun.isPolarDay()) {
+            startMinute = endMinute = 0;
+        } else if(sun.isPolarNight()) {
+            startMinute = 0;
+            endMinute = day;
+        } else {
+            const int offset = utcOffsetMinutes(tm);
+            startMinute = ((sun.sunset + offset) % day + day) % day;
+            endMinute = ((sun.sunrise + offset) % day + day) % day;
+        }
+    }
+
+    log_d("Night mode from %02d:%02d to %02d:%02d", startMinute / 60, startMinute % 60, endMinute / 60, endMinute % 60);
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "Settings.h"
+
+/**
+ * The night mode window of one day as local minutes since midnight.
+ * The window is only recomputed when the date, the time zone or the night mode settings change,
+ * otherwise checking the time is a pair of integer comparisons.
+ */
+class NightSchedule {
+public:
+    NightSchedule() = default;
+
+    bool isNight(const struct tm &tm) {
+        if(!valid || !key.matches(tm))
+            update(tm);
+
+        const uint16_t now = tm.tm_hour * 60 + tm.tm_min;
+        if(startMinute <= endMinute)
+            return startMinute <= now && now < endMinute;
+        return now >= startMinute || now < endMinute; // window spans midnight
+    }
+
+    // seconds from tm until the night mode may switch next, at most one day
+    uint32_t secondsToNextChange(const struct tm &tm) {
+        if(!valid || !key.matches(tm))
+            update(tm);
+
+        const uint16_t now = tm.tm_hour * 60 + tm.tm_min;
+        auto minutesUntil = [now](uint16_t boundary) {
+            const uint16_t delta = (boundary % 1440 + 1440 - now) % 1440;
+            return delta ? delta : 1440;
+        };
+        return std::min(minutesUntil(startMinute), minutesUntil(endMinute)) * 60 - tm.tm_sec;
+    }
+
+    void invalidate() { valid = false; }
+
+    uint16_t getStartMinute() const { return startMinute; }
+    uint16_t getEndMinute() const { return endMinute; }
+
+private:
+    struct Key {
+        int year;
+        int yday;
+        int timezone;
+        bool automatic;
+        TimeStruct start;
+        TimeStruct end;
+        int16_t latitude;
+        int16_t longitude;
+
+        static Key fromSettings(const struct tm &tm);
+        bool matches(const struct tm &tm) const;
+    };
+
+    void update(const struct tm &tm);
+
+    static int utcOffsetMinutes(const struct tm &tm);
+
+    Key key;
+    bool valid{false};
+
+    uint16_t startMinute{0};
+    uint16_t endMinute{0};
+};
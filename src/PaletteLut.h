@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+#include "config.h"
+
+/**
+ * All 256 colors of a 16 entry palette, blended exactly like ColorFromPalette() does at full brightness.
+ * The table is built once per palette, coloring a pixel is a single indexed load afterwards.
+ */
+class PaletteLut {
+public:
+    PaletteLut() = default;
+
+    // builds the table for palette, nothing to do if it was built for the same one
+    bool set(const TProgmemRGBPalette16 &palette) {
+        if(source == &palette)
+            return false;
+        build(palette);
+        return true;
+    }
+
+    void build(const TProgmemRGBPalette16 &palette) {
+        const CRGBPalette16 entries(palette);
+        for(size_t i = 0; i < 256; i++)
+            store(i, ColorFromPalette(entries, i, 255, LINEARBLEND));
+        source = &palette;
+    }
+
+    CRGB operator[](uint8_t index) const {
+#ifdef PALETTE_LUT_WORDS
+        return CRGB(colors[index]);
+#else
+        return colors[index];
+#endif
+    }
+
+private:
+#ifdef PALETTE_LUT_WORDS
+    void store(size_t i, const CRGB &c) { colors[i] = uint32_t(c.r) << 16 | uint32_t(c.g) << 8 | c.b; }
+
+    alignas(4) uint32_t colors[256]; // 0x00RRGGBB
+#else
+    void store(size_t i, const CRGB &c) { colors[i] = c; }
+
+    CRGB colors[256];
+#endif
+    const TProgmemRGBPalette16 *source{nullptr};
+};
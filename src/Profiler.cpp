@@ -0,0 +1,82 @@
+#include <Arduino.h>
+extern "C" {
+#include <user_interface.h>
+}
+
+#include "Profiler.h"
+
+Profiler profiler;
+
+namespace {
+
+constexpr const char *phaseNames[Profiler::phaseCount] = {"wifi", "clock", "settings", "buttons", "debug", "idle", "sleep-prep", "sleep"};
+
+inline uint32_t cyclesToMicros(uint32_t cycles) { return cycles / ESP.getCpuFreqMHz(); }
+inline uint32_t rtcTicksToMicros(uint32_t ticks) { return (uint64_t(ticks) * system_rtc_clock_cali_proc()) >> 12; }
+
+// CCOUNT stops in light sleep and wraps after 26.8 s at 160 MHz, these phases are timed by the RTC timer (about 6 µs per tick)
+constexpr bool isLongPhase(Profiler::Phase phase) { return phase == Profiler::Phase::idle || phase == Profiler::Phase::sleep; }
+
+// bucket n holds times below 2^n µs
+inline size_t bucketOf(uint32_t us) {
+    const size_t bucket = us ? 32 - __builtin_clz(us) : 0;
+    return std::min(bucket, Profiler::bucketCount - 1);
+}
+
+} // namespace
+
+void Profiler::begin(History *history) {
+    this->history = history;
+    if(history->head >= historySize || history->count > historySize)
+        *history = History{};
+    lastMark = ESP.getCycleCount();
+    lastRtcMark = system_get_rtc_time();
+}
+
+void Profiler::mark(Phase phase) {
+    const uint32_t now = ESP.getCycleCount();
+    const uint32_t rtcNow = system_get_rtc_time();
+    current[size_t(phase)] += isLongPhase(phase) ? rtcTicksToMicros(rtcNow - lastRtcMark) : cyclesToMicros(now - lastMark);
+    lastMark = now;
+    lastRtcMark = rtcNow;
+}
+
+void Profiler::endCycle() {
+    uint32_t *slot = history ? history->time[history->head] : nullptr;
+
+    for(size_t i = 0; i < phaseCount; i++) {
+        const uint32_t us = current[i];
+        histogram[i][bucketOf(us)]++;
+        if(slot)
+            slot[i] = us;
+        current[i] = 0;
+    }
+    cycles++;
+
+    if(history) {
+        history->head = (history->head + 1) % historySize;
+        history->count = std::min<uint8_t>(history->count + 1, historySize);
+    }
+}
+
+void Profiler::report(Print &out) const {
+    out.printf("profile of %u wake cycles, last %u in us (oldest first), histogram in us\n", cycles, history ? history->count : 0);
+
+    for(size_t i = 0; i < phaseCount; i++) {
+        out.printf("%-10s", phaseNames[i]);
+        for(size_t n = 0; history && n < history->count; n++) {
+            const size_t slot = (history->head + historySize - history->count + n) % historySize;
+            out.printf(" %8u", history->time[slot][i]);
+        }
+        out.print(" |");
+        for(size_t b = 0; b < bucketCount; b++) {
+            if(!histogram[i][b])
+                continue;
+            if(b + 1 < bucketCount)
+                out.printf(" <%u:%u", 1u << b, histogram[i][b]);
+            else
+                out.printf(" >=%u:%u", 1u << (b - 1), histogram[i][b]);
+        }
+        out.println();
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "config.h"
+
+/**
+ * Wake cycle profiler, available with PROFILER defined.
+ * loop() marks the end of each of its phases, the time since the previous mark is accounted to that phase.
+ * Active phases are timed by the cycle counter, idle and sleep by the RTC timer, which keeps running in light sleep.
+ * The last wake cycles are kept in RTC memory (see RtcData), a log2 histogram per phase since boot in RAM.
+ * Send 'p' on the serial port or open /profile in the portal for a report.
+ */
+class Profiler {
+public:
+    enum class Phase : uint8_t { wifi = 0, clock, settings, buttons, debug, idle, sleepPrep, sleep, count };
+    static constexpr size_t phaseCount = size_t(Phase::count);
+    static constexpr size_t historySize = 4;
+    static constexpr size_t bucketCount = 20; // log2 µs, the last one collects everything from 2^18 µs
+
+    struct History {
+        uint8_t head;
+        uint8_t count;
+        uint32_t time[historySize][phaseCount]; // µs, the sleep and idle phases easily take seconds
+    };
+
+    void begin(History *history);
+
+    void mark(Phase phase);
+    // a wake cycle ends when the clock goes back to sleep
+    void endCycle();
+
+    void report(Print &out) const;
+
+private:
+    History *history{nullptr};
+    uint32_t lastMark{0};           // CPU cycles
+    uint32_t lastRtcMark{0};        // RTC timer ticks
+    uint32_t current[phaseCount]{}; // µs
+    uint16_t histogram[phaseCount][bucketCount]{};
+    uint32_t cycles{0};
+};
+
+extern Profiler profiler;
+
+#ifdef PROFILER
+#define PROFILE_MARK(phase) profiler.mark(Profiler::Phase::phase)
+#define PROFILE_END_CYCLE() profiler.endCycle()
+#else
+#define PROFILE_MARK(phase)                                                                                                                          \
+    do {                                                                                                                                             \
+    } while(0)
+#define PROFILE_END_CYCLE()                                                                                                                          \
+    do {                                                                                                                                             \
+    } while(0)
+#endif
@@ -0,0 +1,186 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_RADIO // see config.h
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <sntp.h>
+
+#include "Radio.h"
+#include "RtcState.h"
+#include "Settings.h"
+#include "WordClock.h"
+#include "esp-hal-log.h"
+
+Radio radio;
+
+void Radio::begin(WiFiManager *wm, const char *portalName) {
+    this->wm = wm;
+    this->portalName = portalName;
+
+    // mode changes would otherwise be written to flash on every sync, WiFiManager stores new credentials itself
+    WiFi.persistent(false);
+    WiFi.forceSleepBegin();
+}
+
+void Radio::loop() {
+    const time_t now = time(nullptr);
+
+    switch(state) {
+        case State::off:
+            if(wordClock.syncDue(now) && now >= retryAt) {
+                log_d("NTP sync due, starting the radio");
+                wakeup();
+            }
+            break;
+
+        case State::connecting: {
+            if(!settings.wifiEnable) {
+                shutdown();
+                break;
+            }
+            if(WiFi.isConnected()) {
+                connected();
+                break;
+            }
+
+            const wl_status_t status = WiFi.status();
+            if(path == Path::cached && (millis() - stateStart > cachedTimeout || status == WL_NO_SSID_AVAIL || status == WL_CONNECT_FAILED)) {
+                log_d("cached access point not reachable (%d), scanning", status);
+                fallbacks++;
+                connectFull();
+            } else if(millis() - stateStart > connectTimeout)
+                failed("connect");
+        } break;
+
+        case State::syncing:
+            if(!settings.wifiEnable || !settings.ntpEnabled)
+                shutdown();
+            else if(wordClock.getLastSync() != syncedBefore) {
+                log_d("NTP sync done after %u ms", millis() - stateStart);
+                failures = 0;
+                retryAt = 0;
+                shutdown();
+            } else if(millis() - stateStart > syncTimeout)
+                failed("sync");
+            break;
+
+        case State::portal:
+            if(wm->getConfigPortalActive())
+                break;
+            // a portal the sync opened backs off like any failed sync, unless it brought new credentials
+            if(portalRequested || WiFi.isConnected())
+                shutdown();
+            else
+                failed("portal");
+            break;
+    }
+}
+
+void Radio::startPortal() { openPortal(true); }
+
+void Radio::openPortal(bool requested) {
+    // the modem only, wakeup() would try to connect first
+    if(state == State::off) {
+        WiFi.forceSleepWake();
+        WiFi.mode(WIFI_STA);
+    }
+
+    portalRequested = requested;
+    wm->setConfigPortalTimeout(requested ? 0 : portalTimeout);
+    wordClock.setSetup(wm);
+    wm->startConfigPortal(portalName);
+    enter(State::portal);
+}
+
+void Radio::report(Print &out) const {
+    static const char *const names[] = {"cached", "full"};
+    for(size_t i = 0; i < size_t(Path::count); i++) {
+        const Stats &s = stats[i];
+        out.printf("%-7s %5u connects, last %5u ms, min %5u ms, avg %5u ms, max %5u ms\n", names[i], s.count, s.last, s.count ? s.min : 0,
+                   s.count ? s.total / s.count : 0, s.max);
+    }
+    out.printf("cached access point missed %u times\n", fallbacks);
+}
+
+void Radio::wakeup() {
+    WiFi.forceSleepWake();
+    WiFi.mode(WIFI_STA);
+    connectStart = millis();
+    enter(State::connecting);
+
+    const WiFiCache &cache = rtcMemory.getData()->wifi;
+    if(!cache.channel) {
+        connectFull();
+        return;
+    }
+
+    // associate directly with the known access point on its channel and reuse the last lease
+    path = Path::cached;
+    WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.netmask), IPAddress(cache.dns));
+    WiFi.begin(WiFi.SSID().c_str(), WiFi.psk().c_str(), cache.channel, cache.bssid);
+}
+
+void Radio::connectFull() {
+    path = Path::full;
+    rtcMemory.getData()->wifi.channel = 0;
+    // the full path gets its own latency and timeout, not counting the time the cached one took to fail
+    connectStart = millis();
+    enter(State::connecting);
+
+    // nothing stored to connect with, only the portal can help
+    if(!wm->getWiFiIsSaved()) {
+        log_w("no WiFi credentials stored");
+        openPortal(false);
+        return;
+    }
+
+    // back to DHCP and scanning, connectTimeout and failed() take care of an unreachable network
+    WiFi.config(IPAddress(), IPAddress(), IPAddress());
+    WiFi.begin(WiFi.SSID().c_str(), WiFi.psk().c_str());
+}
+
+void Radio::connected() {
+    const uint32_t latency = millis() - connectStart;
+    Stats &s = stats[size_t(path)];
+    s.min = s.count ? std::min(s.min, latency) : latency;
+    s.max = std::max(s.max, latency);
+    s.last = latency;
+    s.total += latency;
+    s.count++;
+    log_i("connected in %u ms (%s), average %u ms", latency, path == Path::cached ? "cached" : "full", s.total / s.count);
+
+    WiFiCache &cache = rtcMemory.getData()->wifi;
+    memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+    cache.channel = WiFi.channel();
+    cache.ip = WiFi.localIP();
+    cache.gateway = WiFi.gatewayIP();
+    cache.netmask = WiFi.subnetMask();
+    cache.dns = WiFi.dnsIP();
+    rtcMemory.save();
+
+    // restarting the client sends the request right away
+    syncedBefore = wordClock.getLastSync();
+    sntp_init();
+    enter(State::syncing);
+}
+
+void Radio::shutdown() {
+    sntp_stop();
+    // switches the mode off, WiFi.disconnect() would also drop the credentials the next connect needs
+    WiFi.forceSleepBegin();
+    log_d("radio off after %u ms", millis() - stateStart);
+    enter(State::off);
+}
+
+void Radio::enter(State newState) {
+    state = newState;
+    stateStart = millis();
+}
+
+void Radio::failed(const char *reason) {
+    const uint32_t maxDelay = settings.syncInterval * 60;
+    const uint32_t delay = std::min(retryDelay << std::min<uint8_t>(failures, 16), maxDelay);
+    failures = std::min<uint8_t>(failures + 1, 255);
+    retryAt = time(nullptr) + delay;
+    log_w("NTP %s failed %u times, retry in %u s", reason, failures, delay);
+    shutdown();
+}
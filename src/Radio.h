@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiManager.h>
+
+/**
+ * Keeps the modem off and brings it up only for a due NTP sync or a portal session, it is shut down again as soon as that is done.
+ * The SNTP client only runs while the radio is up, the sync deadlines come from WordClock::syncDue().
+ * Connections first try the access point and lease cached in RtcData and fall back to scanning and DHCP if that fails.
+ * The WiFiManager portal opens only on a user request or if no credentials are stored.
+ */
+class Radio {
+public:
+    enum class State : uint8_t { off = 0, connecting, syncing, portal };
+    enum class Path : uint8_t { cached = 0, full, count };
+
+    // connect latencies per path since boot
+    struct Stats {
+        uint16_t count;
+        uint32_t last; // ms
+        uint32_t min;
+        uint32_t max;
+        uint32_t total;
+    };
+
+    Radio() = default;
+
+    // switches the modem off, call early in setup()
+    void begin(WiFiManager *wm, const char *portalName);
+
+    void loop();
+
+    // user requested configuration portal
+    void startPortal();
+
+    bool isBusy() const { return state != State::off; }
+    State getState() const { return state; }
+
+    const Stats &getStats(Path path) const { return stats[size_t(path)]; }
+    uint16_t getFallbacks() const { return fallbacks; }
+    void report(Print &out) const;
+
+private:
+    void wakeup();
+    void connectFull();
+    // a portal the user did not ask for closes after portalTimeout
+    void openPortal(bool requested);
+    void connected();
+    void shutdown();
+    void enter(State newState);
+    void failed(const char *reason);
+
+    WiFiManager *wm{nullptr};
+    const char *portalName{nullptr};
+
+    State state{State::off};
+    uint32_t stateStart{0};
+    time_t syncedBefore{0};
+    bool portalRequested{false};
+
+    Path path{Path::full};
+    uint32_t connectStart{0};
+    Stats stats[size_t(Path::count)]{};
+    uint16_t fallbacks{0};
+
+    // failed syncs back off, the radio stays off until retryAt
+    uint8_t failures{0};
+    time_t retryAt{0};
+
+    static constexpr uint32_t cachedTimeout = 3000; // the cached access point answers within a few hundred ms
+    static constexpr uint32_t connectTimeout = 15000;
+    static constexpr uint32_t syncTimeout = 15000;
+    static constexpr uint32_t portalTimeout = 180; // s
+    static constexpr uint32_t retryDelay = 60; // s, doubled with every failure up to the sync interval
+};
+
+extern Radio radio;
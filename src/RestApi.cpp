@@ -0,0 +1,167 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_WEB // see config.h
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESP8266WiFi.h>
+#include <time.h>
+
+#include "c++23.h"
+#include "esp-hal-log.h"
+
+#include "Radio.h"
+#include "RestApi.h"
+#include "Settings.h"
+#include "WordClock.h"
+#include "genTimezone.h"
+
+constexpr const char *jsonType PROGMEM = "application/json";
+
+RestApi restApi;
+
+void RestApi::bindServerRequests(WiFiManager *wm) {
+    this->wm = wm;
+    auto &srv = wm->server;
+
+    static const char *headers[] = {"If-None-Match", "If-Match"};
+    srv->collectHeaders(headers, std::size(headers));
+
+    srv->on("/api/settings", HTTP_GET, std::bind(&RestApi::handleGetSettings, this));
+    srv->on("/api/settings", HTTP_PATCH, std::bind(&RestApi::handlePatchSettings, this));
+    srv->on("/api/time", HTTP_GET, std::bind(&RestApi::handleGetTime, this));
+    srv->on("/api/time", HTTP_PUT, std::bind(&RestApi::handlePutTime, this));
+    srv->on("/api/state", HTTP_GET, std::bind(&RestApi::handleGetState, this));
+}
+
+void RestApi::handleGetSettings() {
+    log_d("[HTTP] handle route GET /api/settings");
+    auto &srv = wm->server;
+
+    const String etag = settingsEtag();
+    if(srv->header("If-None-Match") == etag) {
+        srv->sendHeader(F("ETag"), etag);
+        srv->send(304, jsonType, "");
+        return;
+    }
+    sendSettings();
+}
+
+void RestApi::handlePatchSettings() {
+    log_d("[HTTP] handle route PATCH /api/settings");
+    auto &srv = wm->server;
+
+    // only update what the client has seen
+    if(srv->hasHeader("If-Match") && srv->header("If-Match") != settingsEtag()) {
+        sendError(412, "settings changed");
+        return;
+    }
+
+    StaticJsonDocument<1024> doc;
+    DeserializationError err = deserializeJson(doc, srv->arg("plain"));
+    if(err || !doc.is<JsonObject>()) {
+        log_e("Deserialze Failed: %s (%d)", err.c_str(), err.code());
+        sendError(400, err ? err.c_str() : "object expected");
+        return;
+    }
+
+    const char *invalid;
+    if(!settings.fromJson(doc.as<JsonVariantConst>(), &invalid)) {
+        char message[48];
+        snprintf(message, sizeof(message), "invalid %s", invalid);
+        sendError(400, message);
+        return;
+    }
+    settings.requestAsyncSave();
+    sendSettings();
+}
+
+void RestApi::handleGetTime() {
+    log_d("[HTTP] handle route GET /api/time");
+
+    const time_t now = time(nullptr);
+    struct tm tm;
+    localtime_r(&now, &tm);
+    char local[20];
+    strftime(local, sizeof(local), "%FT%T", &tm);
+
+    StaticJsonDocument<256> doc;
+    doc["utc"] = uint32_t(now);
+    doc["local"] = local;
+    doc["timezone"] = FPSTR(timezoneName(settings.timezone));
+    doc["ntp"] = settings.ntpEnabled;
+    doc["last-sync"] = uint32_t(wordClock.getLastSync());
+    sendJson(200, doc);
+}
+
+void RestApi::handlePutTime() {
+    log_d("[HTTP] handle route PUT /api/time");
+    auto &srv = wm->server;
+
+    StaticJsonDocument<64> doc;
+    DeserializationError err = deserializeJson(doc, srv->arg("plain"));
+    if(err || !doc["utc"].is<uint32_t>()) {
+        sendError(400, err ? err.c_str() : "utc expected");
+        return;
+    }
+
+    wordClock.adjustInternalTime(doc["utc"].as<uint32_t>());
+    wordClock.timeUpdate(true);
+    handleGetTime();
+}
+
+void RestApi::handleGetState() {
+    log_d("[HTTP] handle route GET /api/state");
+
+    const time_t now = time(nullptr);
+    StaticJsonDocument<384> doc;
+    doc["uptime"] = millis() / 1000;
+    doc["heap"] = ESP.getFreeHeap();
+    doc["mode"] = std::to_underlying(wordClock.getMode());
+    doc["night"] = wordClock.isNight(now);
+    doc["next-wakeup"] = uint32_t(wordClock.nextWakeup(now));
+    doc["settings-writes"] = settings.getWriteCount();
+    doc["rssi"] = WiFi.RSSI();
+
+    JsonObject connects = doc.createNestedObject("connects");
+    const Radio::Stats &cached = radio.getStats(Radio::Path::cached);
+    const Radio::Stats &full = radio.getStats(Radio::Path::full);
+    connects["cached"] = cached.count;
+    connects["full"] = full.count;
+    connects["fallbacks"] = radio.getFallbacks();
+    connects["cached-ms"] = cached.count ? cached.total / cached.count : 0;
+    connects["full-ms"] = full.count ? full.total / full.count : 0;
+    sendJson(200, doc);
+}
+
+void RestApi::sendSettings() {
+    auto &srv = wm->server;
+
+    StaticJsonDocument<1024> doc;
+    settings.toJson(doc.to<JsonObject>());
+    srv->sendHeader(F("ETag"), settingsEtag());
+    srv->sendHeader(F("Cache-Control"), F("no-cache"));
+
+    String json;
+    serializeJson(doc, json);
+    srv->send(200, jsonType, json);
+}
+
+void RestApi::sendJson(int code, JsonDocument &doc) {
+    auto &srv = wm->server;
+
+    srv->sendHeader(F("Cache-Control"), F("no-store"));
+    String json;
+    serializeJson(doc, json);
+    srv->send(code, jsonType, json);
+}
+
+void RestApi::sendError(int code, const char *message) {
+    StaticJsonDocument<128> doc;
+    doc["error"] = message;
+    sendJson(code, doc);
+}
+
+String RestApi::settingsEtag() {
+    char etag[11];
+    snprintf(etag, sizeof(etag), "\"%08x\"", settings.contentCrc());
+    return etag;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFiManager.h>
+
+/**
+ * JSON interface for scripts, served next to the setup page while the portal runs.
+ *   GET   /api/settings   settings as exported to /config.json, with an ETag of their content
+ *   PATCH /api/settings   partial update, fields missing in the body keep their value, honours If-Match
+ *   GET   /api/time       current time, time zone and last NTP sync
+ *   PUT   /api/time       set the clock, {"utc": <epoch>}
+ *   GET   /api/state      runtime state for monitoring
+ */
+class RestApi {
+public:
+    RestApi() = default;
+
+    // called from the web server callback of WordClockPage
+    void bindServerRequests(WiFiManager *wm);
+
+private:
+    void handleGetSettings();
+    void handlePatchSettings();
+    void handleGetTime();
+    void handlePutTime();
+    void handleGetState();
+
+    void sendSettings();
+    void sendJson(int code, JsonDocument &doc);
+    void sendError(int code, const char *message);
+    static String settingsEtag();
+
+    WiFiManager *wm;
+};
+
+extern RestApi restApi;
@@ -0,0 +1,3 @@
+#include "RtcState.h"
+
+RTCMemory<RtcData> rtcMemory;
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+#include <RTCMemory.h>
+
+#include "Profiler.h"
+#include "Settings.h"
+#include "WordClock.h"
+
+/**
+ * The last successful association, lets Radio connect without scanning for the access point or asking DHCP for a lease.
+ * An empty cache (channel 0) takes the normal WiFiManager route.
+ */
+struct WiFiCache {
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t netmask;
+    uint32_t dns;
+};
+
+/**
+ * Everything that survives a reset or deep sleep in the RTC user memory.
+ * RTCMemory zeroes the data if its CRC does not match, e.g. after a power cycle.
+ */
+struct RtcData {
+    WiFiCache wifi;
+    time_t now;
+
+    // live settings snapshot, settingsGeneration counts the updates, flashGeneration is the last one written to flash
+    SettingsRecord settings;
+    uint32_t settingsGeneration;
+    uint32_t flashGeneration;
+
+    ClockState clock;
+
+#ifdef PROFILER
+    Profiler::History profile;
+#endif
+};
+
+// 512 bytes of user memory, RTCMemory skips the 128 bytes used by the OTA boot loader and appends a CRC
+static_assert(sizeof(RtcData) <= 512 - 128 - sizeof(uint32_t), "RtcData does not fit into the RTC user memory");
+
+extern RTCMemory<RtcData> rtcMemory;
@@ -1,8 +1,11 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_SETTINGS // see config.h
+
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <FS.h>
 #include <LittleFS.h>
 
+#include "RtcState.h"
 #include "Settings.h"
 #include "WordClock.h"
 #include "esp-hal-log.h"
@@ -10,6 +13,10 @@
 
 Settings settings;
 
+constexpr size_t defaultTimezone = timezoneIndex("Europe/Vienna");
+constexpr size_t fallbackTimezone = timezoneIndex("Etc/UTC");
+static_assert(defaultTimezone < timezoneSize && fallbackTimezone < timezoneSize, "time zone missing in genTimezone.h");
+
 
 namespace data {
 
@@ -29,7 +36,7 @@ const TProgmemRGBPalette16 Red_p FL_PROGMEM = {0xFF0000, 0xFF0000, 0xFF0000, 0xF
 
 void convertFromJson(JsonVariantConst src, ColorPalette &b) { b.currentPalette = src.as<size_t>(); }
 void convertToJson(const ColorPalette &b, JsonVariant dst) { dst.set(b.currentPalette); }
-bool canConvertFromJson(JsonVariantConst src, const ColorPalette &) { return src.is<size_t>(); }
+bool canConvertFromJson(JsonVariantConst src, const ColorPalette &) { return src.is<size_t>() && src.as<size_t>() < data::colorPalettes.size(); }
 
 void convertFromJson(JsonVariantConst src, TimeStruct &t) {
     t.hour = src["hour"];
@@ -39,7 +46,9 @@ void convertToJson(const TimeStruct &t, JsonVariant dst) {
     dst["hour"] = t.hour;
     dst["minute"] = t.minute;
 }
-bool canConvertFromJson(JsonVariantConst src, const TimeStruct &) { return src["hour"].is<int>() && src["minute"].is<int>(); }
+bool canConvertFromJson(JsonVariantConst src, const TimeStruct &) {
+    return src["hour"].is<uint8_t>() && src["hour"].as<uint8_t>() < 24 && src["minute"].is<uint8_t>() && src["minute"].as<uint8_t>() < 60;
+}
 
 void convertFromJson(JsonVariantConst src, Brightness &b) { b = static_cast<Brightness>(src.as<uint8_t>()); }
 void convertToJson(const Brightness &b, JsonVariant dst) { dst.set(std::to_underlying(b)); }
@@ -58,69 +67,119 @@ Brightness &operator++(Brightness &b, int) {
 
 
 void Settings::loop() {
-    if(saveRequest) {
+    if(saveRequest && millis() - saveRequestTime >= SETTINGS_SAVE_DELAY) {
         saveRequest = false;
         saveSettings();
     }
 }
 
-bool Settings::loadSettings() {
-    bool ret = true;
-    StaticJsonDocument<1024> doc;
+void Settings::loadDefaults() {
+    brightness = Brightness::mid;
+    palette = 0;
+    paletteCycle = 0;
 
-    File f = LittleFS.open(cfgFile, "r");
+    timezone = defaultTimezone;
 
-    if(f) {
-        DeserializationError err = deserializeJson(doc, f);
-        if(err) {
-            log_e("Deserialze Failed: %s (%d)", err.c_str(), err.code());
-            ret = false;
-        }
-    } else {
-        log_e("File not found");
-        ret = false;
-    }
-    f.close();
+    wifiEnable = true;
 
-    brightness = doc["brightness"] | Brightness::mid;
-    palette = doc["palette"] | 0;
+    ntpEnabled = true;
+    ntpServer = "europe.pool.ntp.org";
+    syncInterval = 720;
 
-    timezone = doc["timezone"] | TZ_Names::TZ_Europe_Vienna;
+    logLevel = ARDUHAL_LOG_LEVEL_VERBOSE;
+    log_set_level(logLevel);
 
-    wifiEnable = doc["wifi"] | true;
+#ifdef NIGHTMODE
+    nmEnable = true;
+    nmAutomatic = true;
+    nmStartTime = {20, 00};
+    nmEndTime = {10, 00};
+    latitude = DEFAULT_LATITUDE;
+    longitude = DEFAULT_LONGITUDE;
+#endif
+}
 
-    ntpEnabled = doc["ntp-enabled"] | true;
-    ntpServer = doc["ntp-server"] | "europe.pool.ntp.org";
-    syncInterval = doc["ntp-interval"] | 720;
+void Settings::toRecord(SettingsRecord &rec) const {
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = SettingsRecord::magicValue;
+    rec.version = SettingsRecord::currentVersion;
+    rec.size = sizeof(rec);
+
+    rec.palette = palette;
+    rec.brightness = std::to_underlying(brightness);
+    rec.flags = (wifiEnable ? SettingsRecord::wifiEnable : 0) | (ntpEnabled ? SettingsRecord::ntpEnabled : 0);
+    rec.timezone = timezone;
+    rec.syncInterval = syncInterval;
+    strncpy(rec.ntpServer, ntpServer.c_str(), sizeof(rec.ntpServer) - 1);
+    strncpy_P(rec.timezoneName, timezoneName(timezone), sizeof(rec.timezoneName) - 1);
+    rec.logLevel = logLevel;
+    rec.paletteCycle = paletteCycle;
 
 #ifdef NIGHTMODE
-    nmEnable = doc["nm-endable"] | true;
-    nmAutomatic = doc["nm-automatic"] | true;
-    nmStartTime = doc["nm-start"] | TimeStruct{20, 00};
-    nmEndTime = doc["nm-end"] | TimeStruct{10, 00};
+    rec.flags |= (nmEnable ? SettingsRecord::nmEnable : 0) | (nmAutomatic ? SettingsRecord::nmAutomatic : 0);
+    rec.nmStartHour = nmStartTime.hour;
+    rec.nmStartMinute = nmStartTime.minute;
+    rec.nmEndHour = nmEndTime.hour;
+    rec.nmEndMinute = nmEndTime.minute;
+    rec.latitude = latitude;
+    rec.longitude = longitude;
 #endif
 
-    serializeJsonPretty(doc, Serial);
+    rec.writeCount = writeCount;
+    rec.crc = rec.calcCrc();
+}
 
-    if(!ret)
-        log_w("loaded default value");
-    return ret;
+uint32_t Settings::contentCrc() const {
+    SettingsRecord rec;
+    toRecord(rec);
+    return rec.contentCrc();
 }
 
-void Settings::saveSettings() {
-    File f = LittleFS.open(cfgFile, "w");
-    if(!f) {
-        log_e("Failed to open file for writing!");
-        f.close();
-        return;
-    }
+bool Settings::fromRecord(const SettingsRecord &rec, size_t len) {
+    if(!rec.isValid(len))
+        return false;
+
+    // the record is trusted only as far as the CRC goes, keep indices in range anyway
+    palette = rec.palette < data::colorPalettes.size() ? rec.palette : 0;
+    brightness = rec.brightness < std::to_underlying(Brightness::END_OF_LIST) ? static_cast<Brightness>(rec.brightness) : Brightness::mid;
+    wifiEnable = rec.flags & SettingsRecord::wifiEnable;
+    ntpEnabled = rec.flags & SettingsRecord::ntpEnabled;
+    if(rec.version >= 3) {
+        char name[sizeof(rec.timezoneName) + 1] = {};
+        memcpy(name, rec.timezoneName, sizeof(rec.timezoneName));
+        timezone = findTimezone(name);
+    } else
+        timezone = timezoneFromLegacy(rec.timezone);
+    if(size_t(timezone) >= timezoneSize)
+        timezone = fallbackTimezone;
+    syncInterval = rec.syncInterval;
+    char server[sizeof(rec.ntpServer) + 1] = {};
+    memcpy(server, rec.ntpServer, sizeof(rec.ntpServer));
+    ntpServer = server;
+    paletteCycle = rec.version >= 5 ? rec.paletteCycle : 0;
+    logLevel = rec.version >= 4 ? std::min<uint8_t>(rec.logLevel, ARDUHAL_LOG_LEVEL_VERBOSE) : ARDUHAL_LOG_LEVEL_VERBOSE;
+    log_set_level(logLevel);
 
-    StaticJsonDocument<1024> doc;
+#ifdef NIGHTMODE
+    nmEnable = rec.flags & SettingsRecord::nmEnable;
+    nmAutomatic = rec.flags & SettingsRecord::nmAutomatic;
+    nmStartTime = {rec.nmStartHour, rec.nmStartMinute};
+    nmEndTime = {rec.nmEndHour, rec.nmEndMinute};
+    latitude = rec.latitude;
+    longitude = rec.longitude;
+#endif
+
+    // version 1 had no bookkeeping
+    writeCount = rec.version >= 2 ? rec.writeCount : 0;
+    return true;
+}
 
+void Settings::toJson(JsonVariant doc) const {
     doc["brightness"] = brightness;
     doc["palette"] = palette;
+    doc["palette-cycle"] = paletteCycle;
 
-    doc["timezone"] = timezone;
+    doc["timezone"] = FPSTR(timezoneName(timezone));
 
     doc["wifi"] = wifiEnable;
 
@@ -128,24 +187,251 @@ void Settings::saveSettings() {
     doc["ntp-server"] = ntpServer;
     doc["ntp-interval"] = syncInterval;
 
+    doc["log-level"] = logLevel;
+
 #ifdef NIGHTMODE
     doc["nm-endable"] = nmEnable;
+    doc["nm-automatic"] = nmAutomatic;
     doc["nm-start"] = nmStartTime;
     doc["nm-end"] = nmEndTime;
+    doc["nm-latitude"] = latitude;
+    doc["nm-longitude"] = longitude;
+#endif
+}
+
+bool Settings::isSyncInterval(uint32_t minutes) {
+    return std::any_of(data::syncIntervals.begin(), data::syncIntervals.end(), [minutes](const auto &i) { return i.first == minutes; });
+}
+
+// the key of the first field that is present but out of range, shared by the REST API, the import and the migration
+const char *Settings::validateJson(JsonVariantConst doc) {
+    using Check = bool (*)(JsonVariantConst);
+    const Check isBool = [](JsonVariantConst v) { return v.is<bool>(); };
+    const std::pair<const char *, Check> checks[] = {
+        {"brightness", [](JsonVariantConst v) { return v.is<Brightness>(); }},
+        {"palette", [](JsonVariantConst v) { return v.is<ColorPalette>(); }},
+        {"palette-cycle", [](JsonVariantConst v) { return v.is<uint16_t>(); }},
+        // by name, older exports have the index into the legacy table
+        {"timezone",
+         [](JsonVariantConst v) {
+             if(v.is<const char *>())
+                 return findTimezone(v.as<const char *>()) < timezoneSize;
+             return v.is<unsigned>() && timezoneFromLegacy(v.as<unsigned>()) < timezoneSize;
+         }},
+        {"wifi", isBool},
+        {"ntp-enabled", isBool},
+        {"ntp-server", [](JsonVariantConst v) { return v.is<const char *>() && strlen(v.as<const char *>()) < sizeof(SettingsRecord::ntpServer); }},
+        {"ntp-interval", [](JsonVariantConst v) { return v.is<uint32_t>() && isSyncInterval(v.as<uint32_t>()); }},
+        {"log-level", [](JsonVariantConst v) { return v.is<uint8_t>() && v.as<uint8_t>() <= ARDUHAL_LOG_LEVEL_VERBOSE; }},
+#ifdef NIGHTMODE
+        {"nm-endable", isBool},
+        {"nm-automatic", isBool},
+        {"nm-start", [](JsonVariantConst v) { return v.is<TimeStruct>(); }},
+        {"nm-end", [](JsonVariantConst v) { return v.is<TimeStruct>(); }},
+        {"nm-latitude", [](JsonVariantConst v) { return v.is<int16_t>() && abs(v.as<int16_t>()) <= maxLatitude; }},
+        {"nm-longitude", [](JsonVariantConst v) { return v.is<int16_t>() && abs(v.as<int16_t>()) <= maxLongitude; }},
+#endif
+    };
+
+    for(const auto &[key, valid] : checks) {
+        JsonVariantConst v = doc[key];
+        if(!v.isNull() && !valid(v))
+            return key;
+    }
+    return nullptr;
+}
+
+bool Settings::fromJson(JsonVariantConst doc, const char **invalid) {
+    if(const char *key = validateJson(doc)) {
+        log_w("Invalid setting %s", key);
+        if(invalid)
+            *invalid = key;
+        return false;
+    }
+
+    brightness = doc["brightness"] | brightness;
+    palette = doc["palette"] | palette;
+    paletteCycle = doc["palette-cycle"] | paletteCycle;
+
+    JsonVariantConst tz = doc["timezone"];
+    if(tz.is<const char *>())
+        timezone = findTimezone(tz.as<const char *>());
+    else if(tz.is<unsigned>())
+        timezone = timezoneFromLegacy(tz.as<unsigned>());
+
+    wifiEnable = doc["wifi"] | wifiEnable;
+
+    ntpEnabled = doc["ntp-enabled"] | ntpEnabled;
+    ntpServer = doc["ntp-server"] | ntpServer;
+    syncInterval = doc["ntp-interval"] | syncInterval;
+
+    logLevel = doc["log-level"] | logLevel;
+    log_set_level(logLevel);
+
+#ifdef NIGHTMODE
+    nmEnable = doc["nm-endable"] | nmEnable;
+    nmAutomatic = doc["nm-automatic"] | nmAutomatic;
+    nmStartTime = doc["nm-start"] | nmStartTime;
+    nmEndTime = doc["nm-end"] | nmEndTime;
+    latitude = doc["nm-latitude"] | latitude;
+    longitude = doc["nm-longitude"] | longitude;
 #endif
+    return true;
+}
+
+bool Settings::loadSettings() {
+    // a warm reset or deep sleep wake-up finds the settings in RTC memory, no need to touch the file system
+    if(loadFromRtc())
+        return true;
+
+    loadDefaults();
+    if(!mountFs())
+        return false;
+
+    File f = LittleFS.open(cfgFile, "r");
+    if(!f)
+        return migrateJson();
 
-    serializeJsonPretty(doc, Serial);
-    serializeJson(doc, f);
+    SettingsRecord rec;
+    const size_t len = f.read(reinterpret_cast<uint8_t *>(&rec), sizeof(rec));
     f.close();
+
+    if(!fromRecord(rec, len)) {
+        log_e("Invalid settings record (%u bytes)", len);
+        loadDefaults();
+        return false;
+    }
+    savedCrc = rec.contentCrc();
+    storeToRtc(rec, true);
+    return true;
+}
+
+void Settings::requestAsyncSave() {
+    SettingsRecord rec;
+    toRecord(rec);
+    storeToRtc(rec, false);
+
+    saveRequest = true;
+    saveRequestTime = millis();
+}
+
+void Settings::saveSettings() {
+    SettingsRecord rec;
+    toRecord(rec);
+
+    const uint32_t crc = rec.contentCrc();
+    if(crc == savedCrc) {
+        log_v("Settings unchanged, skip writing");
+        storeToRtc(rec, true);
+        return;
+    }
+    rec.writeCount = ++writeCount;
+    rec.crc = rec.calcCrc();
+
+    if(!mountFs())
+        return;
+
+    File f = LittleFS.open(cfgFile, "w");
+    if(!f) {
+        log_e("Failed to open file for writing!");
+        return;
+    }
+    const bool written = f.write(reinterpret_cast<const uint8_t *>(&rec), sizeof(rec)) == sizeof(rec);
+    f.close();
+    if(!written) {
+        log_e("Failed to write settings");
+        return;
+    }
+    savedCrc = crc;
+    storeToRtc(rec, true);
+    log_d("Settings written (%u writes)", writeCount);
+}
+
+bool Settings::mountFs() {
+    if(fsMounted)
+        return true;
+
+    if(!LittleFS.begin()) {
+        log_w("File system failed to mount. Formatting...");
+        if(!LittleFS.format() || !LittleFS.begin()) {
+            log_e("failed to format & mount file system!");
+            return false;
+        }
+    }
+    log_i("Filesystem mounted");
+    fsMounted = true;
+    return true;
+}
+
+bool Settings::loadFromRtc() {
+    const RtcData *rtc = rtcMemory.getData();
+    if(!fromRecord(rtc->settings))
+        return false;
+
+    if(rtc->settingsGeneration == rtc->flashGeneration) {
+        savedCrc = rtc->settings.contentCrc();
+    } else {
+        // the last change did not make it to flash before the reset
+        savedCrc = 0;
+        saveRequest = true;
+        saveRequestTime = millis();
+    }
+    log_i("Settings restored from RTC memory (generation %u)", rtc->settingsGeneration);
+    return true;
+}
+
+void Settings::storeToRtc(const SettingsRecord &rec, bool flashed) {
+    RtcData *rtc = rtcMemory.getData();
+    if(flashed && rtc->settingsGeneration == rtc->flashGeneration && !memcmp(&rtc->settings, &rec, sizeof(rec)))
+        return;
+
+    rtc->settings = rec;
+    rtc->settingsGeneration++;
+    if(flashed)
+        rtc->flashGeneration = rtc->settingsGeneration;
+    rtcMemory.save();
+}
+
+bool Settings::migrateJson() {
+    File f = LittleFS.open(jsonCfgFile, "r");
+    if(!f) {
+        log_e("File not found");
+        return false;
+    }
+
+    StaticJsonDocument<1024> doc;
+    DeserializationError err = deserializeJson(doc, f);
+    f.close();
+    if(err) {
+        log_e("Deserialze Failed: %s (%d)", err.c_str(), err.code());
+        return false;
+    }
+
+    // older firmware stored values the checks reject now, those keep their default
+    const char *invalid;
+    while(!fromJson(doc.as<JsonVariantConst>(), &invalid))
+        doc.remove(invalid);
+    saveSettings();
+    LittleFS.remove(jsonCfgFile);
+    log_i("Migrated %s to %s", jsonCfgFile, cfgFile);
+    return true;
 }
 
 void Settings::resetSettings(){
+    // drop the RTC copy as well, it would restore the old settings after the restart
+    rtcMemory.getData()->settings.magic = 0;
+    rtcMemory.save();
+
+    if(!settings.mountFs())
+        return;
     LittleFS.remove(cfgFile);
+    LittleFS.remove(jsonCfgFile);
+    settings.savedCrc = 0;
 }
 
 void Settings::cyclePalette() {
     settings.palette++;
-    saveSettings();
+    requestAsyncSave();
 
     log_v("Current Palette: %d", settings.palette);
     wordClock.setPalette(true);
@@ -153,7 +439,7 @@ void Settings::cyclePalette() {
 
 void Settings::cycleBrightness() {
     settings.brightness++;
-    saveSettings();
+    requestAsyncSave();
 
     log_v("Current Brightness: %d", settings.brightness);
     wordClock.setBrightness(true);
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <FastLED.h>
+#include <coredecls.h>
 
 #include "c++23.h"
 #include "config.h"
@@ -20,6 +21,10 @@ const std::array colorPalettes
 
 const std::array paletteNames = std::make_array("Red-Blue", "Red-Fire", "Blue-Ice", "Rainbow", "Party", "Ocean", "Forest", "Green");
 
+// the NTP sync intervals in minutes, no other value is accepted
+constexpr std::array<std::pair<uint32_t, const char *>, 6> syncIntervals = {
+    {{60, "Hourly"}, {4 * 60, "Every 4 hours"}, {12 * 60, "Every 12 hours"}, {24 * 60, "Daily"}, {2 * 24 * 60, "Every 2 days"}, {7 * 24 * 60, "Weekly"}}};
+
 } // namespace config
 
 struct ColorPalette {
@@ -90,12 +95,85 @@ inline uint8_t BrightnessToIndex(Brightness &b) {
     return std::to_underlying(b);
 }
 
+/**
+ * On-flash layout of the settings, read and written in one piece.
+ * The CRC is always the last field, so older (shorter) versions can be validated and migrated in Settings::fromRecord().
+ */
+struct __attribute__((packed)) SettingsRecord {
+    static constexpr uint32_t magicValue = 0x4B4C4357; // "WCLK"
+    static constexpr uint16_t currentVersion = 5;
+
+    enum Flags : uint8_t { wifiEnable = 0x01, ntpEnabled = 0x02, nmEnable = 0x04, nmAutomatic = 0x08 };
+
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;
+
+    uint8_t palette;
+    uint8_t brightness;
+    uint8_t flags;
+    uint16_t timezone; // index into the table of the firmware that wrote the record, version 3 goes by timezoneName
+    uint32_t syncInterval;
+    char ntpServer[64];
+
+    uint8_t nmStartHour;
+    uint8_t nmStartMinute;
+    uint8_t nmEndHour;
+    uint8_t nmEndMinute;
+    int16_t latitude;
+    int16_t longitude;
+
+    // version 2
+    uint32_t writeCount;
+
+    // version 3
+    char timezoneName[32]; // IANA name, survives a regenerated timezone table
+
+    // version 4
+    uint8_t logLevel;
+
+    // version 5
+    uint16_t paletteCycle;
+
+    uint32_t crc; // over all bytes before this one
+
+    static constexpr size_t sizeV1 = 93;
+    static constexpr size_t sizeV2 = 97;
+    static constexpr size_t sizeV3 = 129;
+    static constexpr size_t sizeV4 = 130;
+
+    uint32_t calcCrc() const { return crc32(this, offsetof(SettingsRecord, crc)); }
+    // CRC of the settings alone, without the bookkeeping fields
+    uint32_t contentCrc() const {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(this);
+        const uint32_t head = crc32(bytes, offsetof(SettingsRecord, writeCount));
+        const size_t tail = offsetof(SettingsRecord, timezoneName);
+        return crc32(bytes + tail, offsetof(SettingsRecord, crc) - tail, head);
+    }
+
+    // len is the number of bytes read, the CRC is taken from the end of the record as stored
+    bool isValid(size_t len) const {
+        if(magic != magicValue || size != len || version > currentVersion)
+            return false;
+        if(!(version == 1 && size == sizeV1) && !(version == 2 && size == sizeV2) && !(version == 3 && size == sizeV3)
+           && !(version == 4 && size == sizeV4) && !(version == currentVersion && size == sizeof(SettingsRecord)))
+            return false;
+        uint32_t stored;
+        memcpy(&stored, reinterpret_cast<const uint8_t *>(this) + size - sizeof(stored), sizeof(stored));
+        return stored == crc32(this, size - sizeof(stored));
+    }
+};
+static_assert(SettingsRecord::sizeV1 == offsetof(SettingsRecord, writeCount) + sizeof(uint32_t), "version 1 layout changed");
+static_assert(SettingsRecord::sizeV2 == offsetof(SettingsRecord, timezoneName) + sizeof(uint32_t), "version 2 layout changed");
+static_assert(SettingsRecord::sizeV3 == offsetof(SettingsRecord, logLevel) + sizeof(uint32_t), "version 3 layout changed");
+static_assert(SettingsRecord::sizeV4 == offsetof(SettingsRecord, paletteCycle) + sizeof(uint32_t), "version 4 layout changed");
 
 class Settings {
 public:
     // Settings
     ColorPalette palette;
     Brightness brightness;
+    uint16_t paletteCycle; // s for the animation to run through all palette colors, 0 moves the colors on with the minutes
 
     bool wifiEnable;
 
@@ -105,12 +183,16 @@ public:
 
     int timezone;
 
+    uint8_t logLevel; // runtime threshold of the log, ARDUHAL_LOG_LEVEL_*
+
     // night light
 #ifdef NIGHTMODE
     bool nmEnable;
     bool nmAutomatic;
     TimeStruct nmStartTime;
     TimeStruct nmEndTime;
+    int16_t latitude;  // 1/100 degree, north positive
+    int16_t longitude; // 1/100 degree, east positive
 #endif
 
 
@@ -121,16 +203,49 @@ public:
 
     bool loadSettings();
     void saveSettings();
+    // restore the snapshot kept in RTC memory only
+    bool loadFromRtc();
+
+    void loadDefaults();
+    void toRecord(SettingsRecord &rec) const;
+    bool fromRecord(const SettingsRecord &rec, size_t len = sizeof(SettingsRecord));
+
+    // JSON export/import, fields missing in the document keep their current value
+    void toJson(JsonVariant doc) const;
+    // nothing is changed if a field is invalid, its key is returned in invalid then
+    bool fromJson(JsonVariantConst doc, const char **invalid = nullptr);
+
+    static bool isSyncInterval(uint32_t minutes);
+    static constexpr int16_t maxLatitude = 9000;   // 1/100 degree
+    static constexpr int16_t maxLongitude = 18000; // 1/100 degree
 
     void cycleBrightness();
     void cyclePalette();
-    void requestAsyncSave() { saveRequest = true; }
+
+    // mirror the settings to RTC memory and write them to flash once no further change was requested for SETTINGS_SAVE_DELAY ms
+    void requestAsyncSave();
+    bool isBusy() const { return saveRequest; }
+
+    uint32_t getWriteCount() const { return writeCount; }
+    // changes with every edit of the settings, not with the bookkeeping
+    uint32_t contentCrc() const;
 
     static void resetSettings();
 
 private:
-    static constexpr const char *cfgFile = "/config/wordclock.json";
+    bool mountFs();
+    bool migrateJson();
+    static const char *validateJson(JsonVariantConst doc);
+    void storeToRtc(const SettingsRecord &rec, bool flashed);
+
+    static constexpr const char *cfgFile = "/config/wordclock.bin";
+    static constexpr const char *jsonCfgFile = "/config/wordclock.json";
+    bool fsMounted{false};
     bool saveRequest{false};
+    uint32_t saveRequestTime{0};
+
+    uint32_t writeCount{0}; // flash writes over the lifetime of the settings file
+    uint32_t savedCrc{0};   // CRC of the content last read or written, saves are skipped if nothing changed
 };
 
 extern Settings settings;
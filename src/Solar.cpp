@@ -0,0 +1,23 @@
+#include <Arduino.h>
+
+#include "Solar.h"
+#include "config.h"
+
+namespace solar {
+
+#ifdef SOLAR_TABLE
+static constexpr std::array<SunTimes, 366> sunTable PROGMEM = makeTable(DEFAULT_LATITUDE, DEFAULT_LONGITUDE, std::make_index_sequence<366>{});
+#endif
+
+SunTimes sunTimes(uint16_t dayOfYear, int16_t latitude, int16_t longitude) {
+#ifdef SOLAR_TABLE
+    if(latitude == DEFAULT_LATITUDE && longitude == DEFAULT_LONGITUDE && dayOfYear < sunTable.size()) {
+        SunTimes ret;
+        memcpy_P(&ret, &sunTable[dayOfYear], sizeof(ret));
+        return ret;
+    }
+#endif
+    return calculate(dayOfYear, latitude, longitude);
+}
+
+} // namespace solar
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <Arduino.h>
+#include <array>
+#include <limits>
+
+#include "config.h"
+
+/**
+ * Sunrise and sunset after the NOAA approximation, evaluated with fixed-point math only.
+ * Angles are binary angles (65536 = full turn), sine values are Q15 (32768 = 1.0), locations are 1/100 degree.
+ * Everything is constexpr, so a table for a fixed location can be generated at compile time.
+ */
+namespace solar {
+
+struct SunTimes {
+    // UTC minutes since midnight, may lie outside of 0 - 1439 far away from the time zone's meridian
+    int16_t sunrise;
+    int16_t sunset;
+
+    static constexpr int16_t polarDay = std::numeric_limits<int16_t>::min();
+    static constexpr int16_t polarNight = std::numeric_limits<int16_t>::max();
+
+    constexpr bool isPolarDay() const { return sunrise == polarDay; }
+    constexpr bool isPolarNight() const { return sunrise == polarNight; }
+};
+
+namespace detail {
+
+// first quadrant of the sine in 64 steps
+constexpr uint16_t sinTable[65] = {
+    0, 804, 1608, 2411, 3212, 4011, 4808, 5602, 6393, 7180, 7962, 8740, 9512,
+    10279, 11039, 11793, 12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531, 18205, 18868,
+    19520, 20160, 20788, 21403, 22006, 22595, 23170, 23732, 24279, 24812, 25330, 25833, 26320,
+    26791, 27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957, 30274, 30572, 30853, 31114,
+    31357, 31581, 31786, 31972, 32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758, 32768};
+
+constexpr int32_t sin(uint16_t angle) {
+    const uint8_t quadrant = angle >> 14;
+    uint16_t x = angle & 0x3FFF;
+    if(quadrant & 1)
+        x = 0x4000 - x;
+
+    const uint8_t index = x >> 8;
+    const uint8_t frac = x & 0xFF;
+    int32_t value = sinTable[index];
+    if(index < 64)
+        value += ((sinTable[index + 1] - sinTable[index]) * frac) >> 8;
+    return (quadrant & 2) ? -value : value;
+}
+
+constexpr int32_t cos(uint16_t angle) { return sin(angle + 0x4000); }
+
+// binary angle in 0 - 180 degrees, cos is falling on that range so bisect for it
+constexpr uint16_t acos(int32_t value) {
+    uint16_t lo = 0;
+    uint16_t hi = 0x8000;
+    while(hi - lo > 1) {
+        const uint16_t mid = (lo + hi) / 2;
+        if(cos(mid) > value)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+constexpr uint16_t toAngle(int16_t centiDegrees) { return int32_t(centiDegrees) * 65536 / 36000; }
+
+constexpr int16_t secondsToMinutes(int32_t s) { return (s >= 0) ? (s + 30) / 60 : -((-s + 30) / 60); }
+
+} // namespace detail
+
+// dayOfYear is 0 based like tm_yday, latitude/longitude in 1/100 degree, north and east positive
+constexpr SunTimes calculate(uint16_t dayOfYear, int16_t latitude, int16_t longitude) {
+    using namespace detail;
+
+    // fractional year at noon of the day
+    const uint16_t g = uint32_t(2 * dayOfYear + 1) * 32768 / 365;
+    const int32_t c1 = cos(g), s1 = sin(g);
+    const int32_t c2 = cos(2 * g), s2 = sin(2 * g);
+    const int32_t c3 = cos(3 * g), s3 = sin(3 * g);
+
+    // declination as binary angle and equation of time in seconds
+    const int32_t declination = 72 + (-4171 * c1 + 733 * s1 - 70 * c2 + 9 * s2 - 28 * c3 + 15 * s3) / 32768;
+    const int32_t eqTime = 1 + (26 * c1 - 441 * s1 - 201 * c2 - 562 * s2) / 32768;
+
+    const uint16_t lat = toAngle(latitude);
+    const uint16_t decl = uint16_t(declination);
+
+    // hour angle of sunrise, -476 is cos(90.833 deg) which accounts for refraction and the size of the sun
+    const int64_t num = int64_t(-476) * 32768 - int64_t(sin(lat)) * sin(decl);
+    const int64_t den = int64_t(cos(lat)) * cos(decl);
+    const int64_t cosHa = (den > 0) ? num * 32768 / den : ((num > 0) ? 32768 : -32768);
+
+    if(cosHa >= 32768)
+        return {SunTimes::polarNight, SunTimes::polarNight};
+    if(cosHa <= -32768)
+        return {SunTimes::polarDay, SunTimes::polarDay};
+
+    // 86400 / 65536 seconds per binary angle unit
+    const int32_t ha = int32_t(acos(cosHa)) * 675 / 512;
+    const int32_t noon = 43200 - int32_t(longitude) * 12 / 5 - eqTime;
+
+    return {secondsToMinutes(noon - ha), secondsToMinutes(noon + ha)};
+}
+
+template <size_t... Days> constexpr std::array<SunTimes, sizeof...(Days)> makeTable(int16_t latitude, int16_t longitude, std::index_sequence<Days...>) {
+    return {{calculate(Days, latitude, longitude)...}};
+}
+
+// sunrise and sunset of the day, from the flash table if the location matches the one it was built for
+SunTimes sunTimes(uint16_t dayOfYear, int16_t latitude, int16_t longitude);
+
+} // namespace solar
@@ -1,11 +1,15 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_CLOCK // see config.h
+
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
 #include <coredecls.h> // settimeofday_cb()
+#include <sntp.h>
 #include <sys/time.h>  // struct timeval
 #include <time.h>      // time() ctime()
 
 #include "c++23.h"
 
+#include "RtcState.h"
 #include "Settings.h"
 #include "WordClock.h"
 #include "esp-hal-log.h"
@@ -15,6 +19,13 @@ extern "C" int settimeofday(const struct timeval* tv, const struct timezone* tz)
 
 WordClock wordClock;
 
+// wall clock time in ms, unlike millis() it goes on through light and deep sleep
+static uint64_t wallClockMs() {
+    timeval tv;
+    gettimeofday(&tv, nullptr);
+    return uint64_t(tv.tv_sec) * 1000 + tv.tv_usec / 1000;
+}
+
 /**
  * This routine turns off the I2C bus and clears it
  * on return SCA and SCL pins are tri-state inputs.
@@ -84,15 +95,15 @@ static int I2C_ClearBus() {
 }
 
 void WordClock::begin() {
-    FastLED.addLeds<WS2812B, LED_PIN, GRB>(leds, leds.size()).setCorrection(TypicalSMD5050).setTemperature(DirectSunlight).setDither(1);
-    // FastLED.setMaxPowerInVoltsAndMilliamps(5, LED_PWR_LIMIT);
-    FastLED.clear(true);
-    FastLED.show();
-
-    lang.assign(leds, leds.size());
+#ifdef DEEP_SLEEP
+    // woken up for an NTP sync, the LEDs still show the frame from before the deep sleep
+    const ClockState &state = rtcMemory.getData()->clock;
+    const bool wakeup = ESP.getResetInfoPtr()->reason == REASON_DEEP_SLEEP_AWAKE && state.valid;
+#else
+    const bool wakeup = false;
+#endif
 
-    setBrightness();
-    setPalette();
+    setupLeds(!wakeup);
 
     settimeofday_cb(WordClock::timeUpdate);
 
@@ -128,19 +139,99 @@ void WordClock::begin() {
     mode = Mode::init;
 
     // set the time zone (we do not care that we set it twice, if ntp is armed)
-    setTZ(timezones[settings.timezone][1]);
+    setTimezone();
+
+#ifdef DEEP_SLEEP
+    if(wakeup)
+        restoreState(state);
+#endif
 
-    // start the NTP
-    if(settings.ntpEnabled)
-        configTime(timezones[settings.timezone][1], settings.ntpServer.c_str());
+    // configure the NTP, Radio restarts the client once the radio is up for a sync
+    if(settings.ntpEnabled) {
+        configTime(String(FPSTR(timezoneRule(activeTimezone))).c_str(), settings.ntpServer.c_str());
+        sntp_stop();
+    }
 
     // Give now a chance to the settimeofday callback,
     // because it is *always* deferred to the next yield()/loop()-call.
     yield();
 }
 
+void WordClock::setupLeds(bool clear) {
+    FastLED.addLeds<WS2812B, LED_PIN, GRB>(leds, leds.size()).setCorrection(TypicalSMD5050).setTemperature(DirectSunlight).setDither(1);
+    // FastLED.setMaxPowerInVoltsAndMilliamps(5, LED_PWR_LIMIT);
+    if(clear) {
+        FastLED.clear(true);
+        FastLED.show();
+    }
+
+    lang.assign(leds, leds.size());
+#ifdef FADING
+    fader.setDuration(FADE_DURATION);
+    fader.setFrameTime(FADE_FRAME_TIME);
+#endif
+
+    setBrightness();
+    setPalette();
+}
+
+bool WordClock::resume(const ClockState& state) {
+    if(!state.valid)
+        return false;
+
+    rtc.Begin();
+    if(!rtc.IsDateTimeValid())
+        return false;
+    getTimeFromRtc();
+    setTimezone();
+
+    lastSync = state.lastSync;
+    if(syncDue(time(nullptr)))
+        return false;
+
+    // the LEDs kept the last frame while we were sleeping
+    setupLeds(false);
+    rtc.LatchAlarmsTriggeredFlags();
+    restoreState(state);
+    mode = Mode::init;
+    return true;
+}
+
+void WordClock::restoreState(const ClockState& state) {
+    lastMinute = state.lastMinute;
+    startColor = state.startColor;
+    lastSync = state.lastSync;
+
+    // render the shown frame again, so changed words fade from it
+    struct tm tm;
+    localtime_r(&state.lastRender, &tm);
+    lang.showTime(&tm);
+    colorize(isNightmode(tm));
+    lastRender = state.lastRender;
+    lastFrameHash = state.frameHash;
+    fader.shown(leds);
+}
+
+void WordClock::saveState(ClockState& state) const {
+    state.valid = true;
+    state.lastMinute = lastMinute;
+    state.startColor = startColor;
+    state.frameHash = lastFrameHash;
+    state.lastRender = lastRender;
+    state.lastSync = lastSync;
+}
+
+bool WordClock::isNight(time_t now) const {
+    struct tm tm;
+    localtime_r(&now, &tm);
+    return isNightmode(tm);
+}
+
+bool WordClock::syncDue(time_t at) const { return settings.wifiEnable && settings.ntpEnabled && at - lastSync >= time_t(settings.syncInterval) * 60; }
+
 void WordClock::loop() {
     bool updateOutput = false;
+    setTimezone();
     const time_t now = time(nullptr);
     struct tm tm;
 
@@ -170,7 +261,7 @@ void WordClock::loop() {
         case Mode::wifi_setup: {
 
             // override palette
-            currentPalette = data::Red_p;
+            palette.set(data::Red_p);
             nightMode = false;
 
             static CEveryNMillis blink(500);
@@ -195,79 +286,141 @@ void WordClock::loop() {
     if(preview)
         previewMode = false;
 
-    // change the color
+    // the animation takes its colors from the wall clock, without it the colors move on with the minutes
+    const uint32_t step = colorStep();
+    animating = step && mode == Mode::running && !nightMode;
     static CEveryNSeconds changeColor(30);
-    if(changeColor)
+    if(changeColor && !step)
         startColor += 10;
 
-    // color the leds
-    if(updateOutput || previewMode)
+    // color the leds, a new step of the animation only needs the lit ones and never interrupts a fade
+    const uint8_t phase = animating ? wallClockMs() / step : startColor;
+    if(updateOutput || previewMode) {
+        startColor = phase;
         colorOutput(nightMode);
+    } else if(animating && !fader.isActive() && phase != startColor) {
+        startColor = phase;
+        animate();
+    }
+
+    // advance a running transition
+    if(fader.step(leds, millis()))
+        showFrame();
 }
 
 void WordClock::colorOutput(bool nightMode) {
     // log_d("Coloring output (nightmode %d)", nightMode);
+    colorize(nightMode);
+    lastRender = time(nullptr);
+
+    // transitions only while showing the time, the setup modes blink
+    if(mode == Mode::running && fader.start(leds, millis()))
+        fader.step(leds, millis());
+    showFrame();
+}
+
+void RENDER_ATTR WordClock::colorize(bool nightMode) {
+    lit = {};
     if(nightMode) {
-        FastLED.setDither(0);
+        dither = 0;
         FastLED.setBrightness(255);
         // colorize all leds in a dark red
+        uint8_t i = 0;
         for(CRGB& px : leds) {
-            if(px)
+            if(px) {
                 px = nightHSV;
+                lit.set(i, i);
+            }
+            i++;
         }
     } else {
-        FastLED.setDither(1);
+        dither = 1;
+        FastLED.setBrightness(dayBrightness);
         uint8_t i = 0;
         for(CRGB& px : leds) {
-            if(px)
-                px = ColorFromPalette(currentPalette, startColor + i * colorOffset, 255);
+            if(px) {
+                px = palette[startColor + i * colorOffset];
+                lit.set(i, i);
+            }
             i++;
         }
     }
+}
+
+void RENDER_ATTR WordClock::animate() {
+    // the words did not change, so the LEDs outside of lit are still dark
+    lit.forEach([this](size_t i) { leds[i] = palette[startColor + i * colorOffset]; });
+    showFrame();
+}
+
+uint32_t WordClock::colorStep() { return settings.paletteCycle ? std::max(settings.paletteCycle * 1000u / 256, minColorStep) : 0; }
+
+bool WordClock::isBusy() const {
+    if(mode != Mode::running || fader.isActive())
+        return true;
+    const uint32_t step = colorStep();
+    return animating && step && step < awakeColorStep;
+}
+
+uint32_t WordClock::idleTime() const {
+    const uint32_t step = colorStep();
+    if(fader.isActive() || !animating || !step || step >= awakeColorStep)
+        return fader.msUntilNextFrame(millis());
+    return step - wallClockMs() % step;
+}
+
+uint32_t RENDER_ATTR WordClock::frameHash() {
+    // FNV-1a over the pixels and everything FastLED applies on the way out
+    uint32_t hash = 2166136261u;
+    auto add = [&hash](uint8_t b) { hash = (hash ^ b) * 16777619u; };
+
+    for(const CRGB& px : leds) {
+        add(px.r);
+        add(px.g);
+        add(px.b);
+    }
+    add(FastLED.getBrightness());
+    add(dither);
+    return hash;
+}
+
+bool WordClock::showFrame() {
+    const uint32_t hash = frameHash();
+    if(hash == lastFrameHash)
+        return false;
+
+    lastFrameHash = hash;
+    FastLED.setDither(dither);
     FastLED.show();
     FastLED.show();
+    fader.shown(leds);
+    return true;
 }
 
 bool WordClock::isNightmode(const struct tm& tm) const {
-    auto start = settings.nmStartTime;
-    auto end = settings.nmEndTime;
-
-    if(settings.nmAutomatic) {
-        // automatic mode, calculate sunrise and sunset
-        const uint32_t sunrise = 289 + 116 * cos((tm.tm_yday + 8) / 58.09);
-        const uint32_t sunset =  1019.5 - 119.5 * cos((tm.tm_yday + 8) / 58.09);
-
-        struct tm tmp = tm;
-        time_t time = 0;
-
-        // convert UTC to local time for the sunset
-        tmp.tm_hour = sunset / 60;
-        time = mktime(&tmp);
-        localtime_r(&time, &tmp);
-        tmp.tm_min = sunset % 60;
-        start.hour = sunrise / 60;
-        start.minute = sunrise % 60;
-
-
-        // convert UTC to local time for the sunrise
-        tmp.tm_hour = sunrise / 60;
-        tmp.tm_min = sunrise % 60;
-        time = mktime(&tmp);
-        localtime_r(&time, &tmp);
-        end.hour = sunset / 60;
-        end.minute = sunset % 60;
-    }
-
-    return settings.nmEnable && (start < tm || end > tm || forceNightMode);
+    if(!settings.nmEnable)
+        return false;
+    return forceNightMode || nightSchedule.isNight(tm);
 }
 
 void WordClock::setPalette(bool force) {
-    currentPalette = *data::colorPalettes[settings.palette];
+    palette.set(*data::colorPalettes[settings.palette]);
 
     if(force)
         lastMinute = -1;
 }
 
+void WordClock::setTimezone() {
+    if(activeTimezone == settings.timezone)
+        return;
+
+    // a new offset of whole hours keeps the minute, redraw the words anyway
+    if(activeTimezone >= 0)
+        lastMinute = -1;
+    activeTimezone = settings.timezone;
+    setTZ(String(FPSTR(timezoneRule(activeTimezone))).c_str());
+    log_i("Time zone %s", FPSTR(timezoneName(activeTimezone)));
+}
 
 void WordClock::setBrightness(bool force) {
     constexpr std::array brightnessValues = {120, 200, 255};
@@ -282,55 +435,78 @@ void WordClock::setBrightness(bool force) {
 #endif
     {
         const auto newBrightness = BrightnessToIndex(settings.brightness);
-        FastLED.setBrightness(brightnessValues[newBrightness]);
+        dayBrightness = brightnessValues[newBrightness];
         forceNightMode = false;
     }
 }
 
-constexpr int roundUp(const int numToRound, const int multiple) { return ((numToRound + multiple - 1) / multiple) * multiple; }
-
-void WordClock::prepareAlarm() {
-    const time_t now = time(nullptr);
+time_t WordClock::nextWakeup(time_t now) {
     struct tm tm;
-
     localtime_r(&now, &tm);
-    const bool nightMode = isNightmode(tm);
 
-    // setup next wake event, dependent on the state of night mode
-    if(!nightMode) {
-        // wake up every minute
-        rtc.SetAlarmTwo(DS3231AlarmTwo(0, 0, 0, DS3231AlarmTwoControl::DS3231AlarmTwoControl_OncePerMinute));
-        rtc.LatchAlarmsTriggeredFlags();
-        return;
+    // the words change every five minutes
+    uint32_t seconds = (5 - tm.tm_min % 5) * 60 - tm.tm_sec;
+
+    // night mode switches at its own times
+    if(settings.nmEnable && !forceNightMode)
+        seconds = std::min(seconds, nightSchedule.secondsToNextChange(tm));
+
+    time_t wakeup = now + seconds;
+
+    // the next color of a slow palette animation, the RTC alarm has a resolution of seconds
+    if(const uint32_t step = colorStep(); animating && step) {
+        const uint64_t next = (wallClockMs() / step + 1) * step;
+        wakeup = std::min(wakeup, time_t((next + 999) / 1000));
     }
 
-    int nextWakeup = roundUp(tm.tm_min + 1, 5);
-    if(nextWakeup >= 60)
-        nextWakeup = 0;
-    log_v("Next wakeup at %d minutes", nextWakeup);
+    // the SNTP client only runs while the radio is up for a sync
+    if(settings.wifiEnable && settings.ntpEnabled && !syncDue(now))
+        wakeup = std::min(wakeup, lastSync + time_t(settings.syncInterval) * 60);
 
-    rtc.SetAlarmTwo(DS3231AlarmTwo(0, 0, nextWakeup, DS3231AlarmTwoControl::DS3231AlarmTwoControl_MinutesMatch));
+    return wakeup;
+}
+
+uint32_t WordClock::prepareAlarm() {
+    const time_t now = time(nullptr);
+    const time_t wakeup = nextWakeup(now);
+
+    // the RTC runs on UTC, alarm two has a resolution of minutes, alarm one of seconds
+    struct tm tm;
+    gmtime_r(&wakeup, &tm);
+    if(tm.tm_sec == 0) {
+        rtc.SetAlarmTwo(DS3231AlarmTwo(0, tm.tm_hour, tm.tm_min, DS3231AlarmTwoControl::DS3231AlarmTwoControl_HoursMinutesMatch));
+        rtc.SetSquareWavePin(DS3231SquareWavePin_ModeAlarmTwo);
+    } else {
+        rtc.SetAlarmOne(DS3231AlarmOne(0, tm.tm_hour, tm.tm_min, tm.tm_sec, DS3231AlarmOneControl::DS3231AlarmOneControl_HoursMinutesSecondsMatch));
+        rtc.SetSquareWavePin(DS3231SquareWavePin_ModeAlarmOne);
+    }
     rtc.LatchAlarmsTriggeredFlags();
+    log_v("Next wakeup at %02d:%02d:%02d UTC", tm.tm_hour, tm.tm_min, tm.tm_sec);
+
+    return wakeup - now;
 }
 
 void WordClock::printDebugTime() {
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_DEBUG
+    // nothing would be logged, skip the RTC read as well
+    if(LOG_LOCAL_LEVEL < ARDUHAL_LOG_LEVEL_DEBUG || log_get_level() < ARDUHAL_LOG_LEVEL_DEBUG)
+        return;
+
     log_d("----------------------------");
     const time_t now = time(nullptr);
     const RtcDateTime rtcNow = rtc.GetDateTime();
     struct tm tm;
 
-    char buf[64];
-
+    // raw fields, the log formats them later
     gmtime_r(&now, &tm);
-    strftime(buf, sizeof(buf), "%F %T", &tm);
-    log_d("UTC:   %s", buf);
+    log_d("UTC:   %04d-%02d-%02d %02d:%02d:%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
 
     localtime_r(&now, &tm);
-    strftime(buf, sizeof(buf), "%F %T", &tm);
-    log_d("Local: %s", buf);
+    log_d("Local: %04d-%02d-%02d %02d:%02d:%02d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec);
 
     log_d("RTC:   %04d-%02d-%02d %02d:%02d:%02d", rtcNow.Year(), rtcNow.Month(), rtcNow.Day(), rtcNow.Hour(), rtcNow.Minute(), rtcNow.Second());
     log_d("----------------------------");
+#endif
 }
 
 void WordClock::setSetup(WiFiManager*) { wordClock.mode = Mode::wifi_setup; }
@@ -343,8 +519,8 @@ void WordClock::setRunning() {
 
 void WordClock::showReset() {
     log_v("Resetting settings");
-    currentPalette = data::Red_p;
-    FastLED.setBrightness(255);
+    palette.set(data::Red_p);
+    dayBrightness = 255;
 
     for(int i = 0; i < 10; i++) {
         // blink reset text
@@ -378,9 +554,11 @@ void WordClock::timeUpdate(bool sntp) {
         RtcDateTime newVal;
         newVal.InitWithEpoch32Time(time(nullptr));
         wordClock.rtc.SetDateTime(newVal);
+        wordClock.lastSync = time(nullptr);
     }
 }
 
+// the radio is shut down right after a sync, Radio schedules the next one after the same interval
 uint32_t sntp_update_delay_MS_rfc_not_less_than_15000() {
     uint32_t syncMillis = settings.syncInterval * 60 * 1000;
     return syncMillis;
@@ -3,11 +3,32 @@
 #include <FastLED.h>
 #include <WiFiManager.h>
 
+#include "Fader.h"
 #include "Language.h"
+#include "NightSchedule.h"
+#include "PaletteLut.h"
 #include "Rtc.h"
 #include "Settings.h"
 #include "config.h"
 
+#ifdef RENDER_IN_IRAM
+#define RENDER_ATTR IRAM_ATTR
+#else
+#define RENDER_ATTR
+#endif
+
+/**
+ * Runtime state of the clock kept in RTC memory across deep sleep.
+ */
+struct ClockState {
+    bool valid;
+    int8_t lastMinute;
+    uint8_t startColor;
+    uint32_t frameHash; // of the frame the LEDs are showing
+    time_t lastRender;  // time the shown frame was rendered for
+    time_t lastSync;    // last successful NTP sync
+};
+
 class WordClock {
 public:
     enum class Mode : uint8_t { init = 0, running, setup, wifi_setup };
@@ -24,6 +45,8 @@ public:
 
     void setBrightness(bool force = false);
     void setPalette(bool force = false);
+    // applies the time zone of the settings, nothing to do if it did not change
+    void setTimezone();
 
     void printDebugTime();
     void latchAlarmflags() { rtc.LatchAlarmsTriggeredFlags(); }
@@ -33,30 +56,73 @@ public:
     void showReset();
     static void timeUpdate(bool sntp);
 
-    bool isBusy() const { return mode != Mode::running; }
-    void prepareAlarm();
+    bool isBusy() const;
+    // ms the clock has nothing to do while it is busy fading or animating the palette
+    uint32_t idleTime() const;
+    // earliest time the clock has something to do: new words, a night mode switch, a palette animation step or an NTP sync
+    time_t nextWakeup(time_t now);
+    // arms the RTC alarm for nextWakeup(), returns the seconds until it fires
+    uint32_t prepareAlarm();
+
+    void saveState(ClockState &state) const;
+    // take over the frame shown before a deep sleep, false if the state is unusable or an NTP sync is due
+    bool resume(const ClockState &state);
+    Mode getMode() const { return mode; }
+    bool isNight(time_t now) const;
+    bool syncDue(time_t at) const;
+    time_t getLastSync() const { return lastSync; }
 
 private:
+    friend class Benchmark;
+
+    void setupLeds(bool clear);
+    void restoreState(const ClockState &state);
+
     void colorOutput(bool nightMode = false);
+    void colorize(bool nightMode);
+    // recolor the lit LEDs for the next step of the palette animation
+    void animate();
+    // ms per palette color of the animation, 0 if it is off
+    // the settings may change between two loop() passes, read it once and check it before dividing by it
+    static uint32_t colorStep();
     bool isNightmode(const struct tm &tm) const;
 
+    // transmit the frame to the LEDs, skipped if it is identical to the last one sent
+    bool showFrame();
+    uint32_t frameHash();
+
     LangImpl lang;
     CRGBArray<LangImpl::getLedCount()> leds;
+    LedMask<LangImpl::getLedCount()> lit; // LEDs colored by the last colorize(), the animation recolors only these
+    Fader<LangImpl::getLedCount()> fader;
     Rtc rtc{rtcInstance()};
     Mode mode{Mode::init};
 
     int8_t lastMinute;
+    int activeTimezone{-1}; // passed to setTZ() last
 
     bool previewMode{false};
     CEveryNSeconds preview{CEveryNBSeconds(2)};
 
     // coloring stuff
     bool forceNightMode{false};
+    mutable NightSchedule nightSchedule;
     const CHSV nightHSV{CHSV(0, 255, 100)};
 
-    CRGBPalette16 currentPalette;
+    uint8_t dayBrightness{255}; // applied with the next colorize(), fading frames keep the brightness they were colored for
+    uint8_t dither{1};
+    uint32_t lastFrameHash{0};
+
+    time_t lastRender{0};
+    time_t lastSync{0};
+
+    PaletteLut palette; // of the current palette, rebuilt when it changes
     uint8_t startColor{0};
     static constexpr uint8_t colorOffset = 8;
+
+    bool animating{false}; // palette animation running, off at night and in the setup modes
+    static constexpr uint32_t minColorStep = 20;     // ms, one LED frame
+    static constexpr uint32_t awakeColorStep = 2000; // ms, faster animations keep the clock awake instead of waking it by RTC alarm
 };
 
 extern WordClock wordClock;
@@ -1,18 +1,28 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_WEB // see config.h
+
 #include <Arduino.h>
+#include <ArduinoJson.h>
+#include <StreamString.h>
 #include <time.h>
 
 #include "c++23.h"
 #include "config.h"
 #include "esp-hal-log.h"
 
+#include "ChunkedResponse.h"
+#include "Profiler.h"
+#include "Radio.h"
+#include "RestApi.h"
 #include "Settings.h"
 #include "WordClock.h"
 #include "WordClockPage.h"
 #include "genTimezone.h"
+#include "genTimezoneJson.h"
 
 constexpr const char *menuhtml PROGMEM = "<form action='/custom' method='get'><button>Setup Clock</button></form><br/>";
-constexpr std::array<std::pair<int, const char *>, 5> syncDefault PROGMEM
-    = {{{60, "Hourly"}, {240, "Every 12 hour"}, {1140, "Daily"}, {2880, "Every 2 days"}, {10080, "Weekly"}}};
+// seconds for one cycle through the palette
+constexpr std::array<std::pair<int, const char *>, 5> paletteCycles PROGMEM
+    = {{{0, "Off"}, {60, "1 minute"}, {300, "5 minutes"}, {900, "15 minutes"}, {3600, "1 hour"}}};
 
 WordClockPage wordClockPage;
 
@@ -27,100 +37,129 @@ void WordClockPage::begin(WiFiManager *wm) {
 void WordClockPage::handleRoute() {
     log_d("HTTP] Handle route Custom");
 
-    String TimeConfHTML;
-    TimeConfHTML.reserve(28000);
-    TimeConfHTML += HTTP_HEAD_START;
-    TimeConfHTML.replace(FPSTR(T_v), "Word Clock setup");
-
-    TimeConfHTML += HTTP_SCRIPT;
-    TimeConfHTML += F("<script>;window.addEventListener('load', function() { var now = new Date(); "
-                      "document.getElementById('set-time').value = now.toISOString().substring(0,16); });"
-                      "</script>");
-    TimeConfHTML += HTTP_STYLE;
-    TimeConfHTML += F("<style>input[type='checkbox'][name='use-ntp-server']:not(:checked) ~.collapsable{display:none;}"
-                      "input[type='checkbox'][name='use-ntp-server']:checked ~.collapsed{display:none;}</style>");
-    TimeConfHTML += HTTP_HEAD_END;
-    TimeConfHTML += F("<iframe name='dummyframe' id='dummyframe' style='display: none;'></iframe>"
-                      "<form action='/save-wc' target='dummyframe' method='POST' novalidate>");
+    ChunkedResponse out(*wm->server, 200, "text/html");
+    auto checked = [&out](bool on) { out.print(on ? F("checked>") : F(">")); };
+    auto selected = [&out](bool on) { out.print(on ? F("' selected>") : F("'>")); };
+
+    String head(FPSTR(HTTP_HEAD_START));
+    head.replace(FPSTR(T_v), "Word Clock setup");
+    out.print(head);
+
+    out.print(FPSTR(HTTP_SCRIPT));
+    out.print(F("<script>;window.addEventListener('load', function() { var now = new Date(); "
+                "document.getElementById('set-time').value = now.toISOString().substring(0,16); });"
+                "</script>"));
+    out.print(FPSTR(HTTP_STYLE));
+    out.print(F("<style>input[type='checkbox'][name='use-ntp-server']:not(:checked) ~.collapsable{display:none;}"
+                "input[type='checkbox'][name='use-ntp-server']:checked ~.collapsed{display:none;}</style>"));
+    out.print(FPSTR(HTTP_HEAD_END));
+    out.print(F("<iframe name='dummyframe' id='dummyframe' style='display: none;'></iframe>"
+                "<form action='/save-wc' target='dummyframe' method='POST' novalidate>"));
     const int brightness = BrightnessToIndex(settings.brightness);
-    TimeConfHTML += F("<h1>WordClock Settings</h1>"
-                      "<p>Brightness</p>"
-                      "<input style='display: inline-block;' type='radio' id='choice1' name='brightness' value='0' ");
-    TimeConfHTML += (brightness == 0) ? "checked>" : ">";
-    TimeConfHTML += F("<label for='choice1'>Low</label><br/>"
-                      "<input style='display: inline-block;' type='radio' id='choice2' name='brightness' value='1' ");
-    TimeConfHTML += (brightness == 1) ? "checked>" : ">";
-    TimeConfHTML += F("<label for='choice2'>Medium</label><br/>"
-                      "<input style='display: inline-block;' type='radio' id='choice3' name='brightness' value='2' ");
-    TimeConfHTML += (brightness == 2) ? "checked>" : ">";
-    TimeConfHTML += F("<label for='choice3'>high</label><br/>");
+    out.print(F("<h1>WordClock Settings</h1>"
+                "<p>Brightness</p>"
+                "<input style='display: inline-block;' type='radio' id='choice1' name='brightness' value='0' "));
+    checked(brightness == 0);
+    out.print(F("<label for='choice1'>Low</label><br/>"
+                "<input style='display: inline-block;' type='radio' id='choice2' name='brightness' value='1' "));
+    checked(brightness == 1);
+    out.print(F("<label for='choice2'>Medium</label><br/>"
+                "<input style='display: inline-block;' type='radio' id='choice3' name='brightness' value='2' "));
+    checked(brightness == 2);
+    out.print(F("<label for='choice3'>high</label><br/>"));
 #ifdef NIGHTMODE
-    TimeConfHTML += F("<input style='display: inline-block;' type='radio' id='choice4' name='brightness' value='3' ");
-    TimeConfHTML += (brightness == 3) ? "checked>" : ">";
-    TimeConfHTML += F("<label for='choice4'>night</label>");
+    out.print(F("<input style='display: inline-block;' type='radio' id='choice4' name='brightness' value='3' "));
+    checked(brightness == 3);
+    out.print(F("<label for='choice4'>night</label>"));
 #endif
-    TimeConfHTML += F("<br /><br /> "
-                      "<label for='palette'>Color Palette</label>"
-                      "<select name='palette' id='palette' class='button'>");
+    out.print(F("<br /><br /> "
+                "<label for='palette'>Color Palette</label>"
+                "<select name='palette' id='palette' class='button'>"));
     uint8_t i = 0;
     for(const auto p : data::paletteNames) {
-        TimeConfHTML += F("<option value='") + String(i);
-        TimeConfHTML += (settings.palette == i) ? "' selected>" : "'>";
-        TimeConfHTML += String(p) + F("</option>");
+        out.print(F("<option value='"));
+        out.print(i);
+        selected(settings.palette == i);
+        out.print(p);
+        out.print(F("</option>"));
         i++;
     }
-    TimeConfHTML += F("</select>"
-                      "<h1>Time Settings</h1>"
-                      "<label for='timezone'>Time Zone</label>"
-                      "<select id='timezone' name='timezone'>");
-    for(size_t i = 0; i < timezoneSize; i++) {
-        bool selected = (settings.timezone == i);
-        TimeConfHTML += F("<option value='") + String(i) + String(selected ? "' selected>" : "'>");
-        TimeConfHTML += String(FPSTR(timezones[i][0])) + "</option>";
+    out.print(F("</select><br><br>"
+                "<label for='palette-cycle'>Color Animation</label>"
+                "<select name='palette-cycle' id='palette-cycle' class='button'>"));
+    for(const auto &[seconds, name] : paletteCycles) {
+        out.print(F("<option value='"));
+        out.print(seconds);
+        selected(settings.paletteCycle == seconds);
+        out.print(name);
+        out.print(F("</option>"));
     }
-    TimeConfHTML += F("</select><br><br>"
-                      "<label for='use-wifi'>Enable portal on startup (wifi always on)</label>"
-                      "<input value='1' type=checkbox name='use-wifi' id='use-wifi'");
-    TimeConfHTML += String(settings.wifiEnable ? "checked>" : ">");
-    TimeConfHTML += F("</select><br><br>"
-                      "<label for='use-ntp-server'>Enable NTP Client</label> "
-                      "<input value='1' type=checkbox name='use-ntp-server' id='use-ntp-server'");
-    TimeConfHTML += String(settings.ntpEnabled ? "checked>" : ">");
-    TimeConfHTML += F("<br/>"
-                      "<div class='collapsed'>"
-                      "<label for='set-time'>Set Time (UTC)"
-                      "<input style=width:auto name='set-time' step='1' id='set-time' type='datetime-local'></div>"
-                      "<div class='collapsable'>"
-                      "<h2>NTP Client Setup</h2>"
-                      "<br><label for='ntp-server'>Server:</label>"
-                      "<input type='text' id='ntp-server' name='ntp-server' value='");
-    TimeConfHTML += settings.ntpServer;
-    TimeConfHTML += F("'><br>"
-                      "<label for='ntp-interval'>Sync interval:</label>"
-                      "<select id='ntp-interval' name='ntp-interval'>");
-    for(const auto &[min, name] : syncDefault) {
-        TimeConfHTML += F("<option value='") + String(min);
-        TimeConfHTML += (settings.syncInterval == min) ? "' selected>" : "'>";
-        TimeConfHTML += String(name) + "</option>";
+    out.print(F("</select>"
+                "<h1>Time Settings</h1>"
+                "<label for='timezone'>Time Zone</label>"
+                "<select id='timezone' name='timezone'><option value='"));
+    out.print(settings.timezone);
+    out.print(F("' selected>"));
+    out.print(FPSTR(timezoneName(settings.timezone)));
+    // the other zones come from the cached catalogue, the current one keeps the form usable until it arrived
+    out.print(F("</option></select><script>fetch('/timezones.json?v="));
+    out.print(FPSTR(timezonesJsonVersion));
+    out.print(F("').then(r => r.json()).then(names => { var s = document.getElementById('timezone'), v = s.value; s.innerHTML = '';"
+                "names.forEach((n, i) => s.add(new Option(n, i, false, i == v))); });</script>"));
+    out.print(F("<br><br>"
+                "<label for='use-wifi'>Use WiFi (on only while an NTP sync runs)</label>"
+                "<input value='1' type=checkbox name='use-wifi' id='use-wifi'"));
+    checked(settings.wifiEnable);
+    out.print(F("</select><br><br>"
+                "<label for='use-ntp-server'>Enable NTP Client</label> "
+                "<input value='1' type=checkbox name='use-ntp-server' id='use-ntp-server'"));
+    checked(settings.ntpEnabled);
+    out.print(F("<br/>"
+                "<div class='collapsed'>"
+                "<label for='set-time'>Set Time (UTC)"
+                "<input style=width:auto name='set-time' step='1' id='set-time' type='datetime-local'></div>"
+                "<div class='collapsable'>"
+                "<h2>NTP Client Setup</h2>"
+                "<br><label for='ntp-server'>Server:</label>"
+                "<input type='text' id='ntp-server' name='ntp-server' value='"));
+    out.print(settings.ntpServer);
+    out.print(F("'><br>"
+                "<label for='ntp-interval'>Sync interval:</label>"
+                "<select id='ntp-interval' name='ntp-interval'>"));
+    for(const auto &[min, name] : data::syncIntervals) {
+        out.print(F("<option value='"));
+        out.print(min);
+        selected(settings.syncInterval == min);
+        out.print(name);
+        out.print(F("</option>"));
     }
-    TimeConfHTML += F("</select><br>"
-                      "</div>");
-    TimeConfHTML += F("<h2>Night Mode Setup</h2>"
-                      "<label for='use-night-mode'>Enable Night Mode</label>"
-                      "<input value='1' type=checkbox name='use-night-mode' id='use-night-mode'");
-    TimeConfHTML += String(settings.nmEnable ? "checked>" : ">");
-    TimeConfHTML += F("<br><label for='nm-auto'>Use Sunrise/Sunset for Night Mode</label>"
-                      "<input value='1' type=checkbox name='nm-auto' id='nm-auto'");
-    TimeConfHTML += String(settings.nmAutomatic ? "checked>" : ">");
-    TimeConfHTML += F("<br><label for='nm-start'>Start Time:</label><input style=width:auto type='time' name='nm-start' id='nm-start' value='");
-    TimeConfHTML += settings.nmStartTime.toString() + "'>";
-    TimeConfHTML += F("<br><label for='nm-end'>End Time:</label><input style=width:auto type='time' name='nm-end' id='nm-end' value='");
-    TimeConfHTML += settings.nmEndTime.toString() + "'>";
-
-    TimeConfHTML += F("<br><br><button type=submit>Submit</button></form>");
-    TimeConfHTML += HTTP_END;
-
-    wm->server->send(200, "text/html", TimeConfHTML.c_str());
+    out.print(F("</select><br>"
+                "</div>"));
+    out.print(F("<h2>Night Mode Setup</h2>"
+                "<label for='use-night-mode'>Enable Night Mode</label>"
+                "<input value='1' type=checkbox name='use-night-mode' id='use-night-mode'"));
+    checked(settings.nmEnable);
+    out.print(F("<br><label for='nm-auto'>Use Sunrise/Sunset for Night Mode</label>"
+                "<input value='1' type=checkbox name='nm-auto' id='nm-auto'"));
+    checked(settings.nmAutomatic);
+    out.print(F("<br><label for='nm-start'>Start Time:</label><input style=width:auto type='time' name='nm-start' id='nm-start' value='"));
+    out.print(settings.nmStartTime.toString());
+    out.print(F("'><br><label for='nm-end'>End Time:</label><input style=width:auto type='time' name='nm-end' id='nm-end' value='"));
+    out.print(settings.nmEndTime.toString());
+    out.print(F("'><br><label for='nm-lat'>Latitude:</label><input style=width:auto type='number' step='0.01' min='-90' max='90' "
+                "name='nm-lat' id='nm-lat' value='"));
+    out.print(settings.latitude / 100.0, 2);
+    out.print(F("'><br><label for='nm-lon'>Longitude:</label><input style=width:auto type='number' step='0.01' min='-180' max='180' "
+                "name='nm-lon' id='nm-lon' value='"));
+    out.print(settings.longitude / 100.0, 2);
+    out.print(F("'>"));
+
+    out.print(F("<br><br><button type=submit>Submit</button></form>"));
+    out.print(F("<h2>Backup</h2><a href='/config.json' download='wordclock.json'>Export Settings</a>"
+                "<form action='/config.json' target='dummyframe' method='POST'>"
+                "<label for='config'>Import Settings:</label><textarea name='config' id='config' rows='4'></textarea>"
+                "<button type=submit>Import</button></form>"));
+    out.print(FPSTR(HTTP_END));
 }
 
 void WordClockPage::handleValues() {
@@ -142,13 +181,20 @@ void WordClockPage::handleValues() {
         settings.palette.currentPalette = palette;
     }
 
+    if(srv->hasArg("palette-cycle")) {
+        const String strCycle = srv->arg("palette-cycle");
+        log_v("palette cycle: %s", strCycle.c_str());
+        settings.paletteCycle = std::clamp(strCycle.toInt(), 0l, 65535l);
+    }
+
     // Timezones
     if(srv->hasArg("timezone")) {
         const String strTz = srv->arg("timezone");
         log_v("Timezone: %s", strTz.c_str());
+        constexpr size_t fallback = timezoneIndex("Etc/UTC");
         size_t tzId = strTz.toInt();
         if(tzId >= timezoneSize)
-            tzId = TZ_Names::TZ_Etc_UTC;
+            tzId = fallback;
         settings.timezone = tzId;
     }
 
@@ -178,19 +224,8 @@ void WordClockPage::handleValues() {
         // request interval (in min)
         const String strNTPInterval = srv->arg("ntp-interval");
         log_v("NTPInterval: %s", strNTPInterval.c_str());
-        auto interval = size_t(strNTPInterval.toInt());
-        switch(interval) {
-            case 60:
-            case 4 * 60:
-            case 12 * 60:
-            case 24 * 60:
-            case 2 * 24 * 60:
-            case 7 * 24 * 60:
-                break;
-            default:
-                interval = 4 * 60;
-        }
-        settings.syncInterval = interval;
+        const auto interval = uint32_t(strNTPInterval.toInt());
+        settings.syncInterval = Settings::isSyncInterval(interval) ? interval : 4 * 60;
     } else {
         // get the time the user set
         const String localTime = srv->arg("set-time");
@@ -230,14 +265,84 @@ void WordClockPage::handleValues() {
             log_v("Failed to parse start time");
             settings.nmEndTime = {8, 0};
         }
+
+        // and the location for sunrise/sunset
+        if(srv->hasArg("nm-lat") && srv->hasArg("nm-lon")) {
+            const String nmLat = srv->arg("nm-lat");
+            const String nmLon = srv->arg("nm-lon");
+            log_v("nmLat: %s, nmLon: %s", nmLat.c_str(), nmLon.c_str());
+            settings.latitude = constrain(lround(nmLat.toFloat() * 100), -Settings::maxLatitude, Settings::maxLatitude);
+            settings.longitude = constrain(lround(nmLon.toFloat() * 100), -Settings::maxLongitude, Settings::maxLongitude);
+        }
+    }
+
+    settings.requestAsyncSave();
+
+    srv->send_P(200, PSTR("text/html"), PSTR("<script>parent.location.href = '/';</script>"));
+}
+
+void WordClockPage::handleExport() {
+    log_d("[HTTP] handle route Export");
+
+    StaticJsonDocument<1024> doc;
+    settings.toJson(doc.to<JsonObject>());
+
+    String json;
+    serializeJson(doc, json);
+    wm->server->send(200, "application/json", json);
+}
+
+void WordClockPage::handleImport() {
+    log_d("[HTTP] handle route Import");
+    auto &srv = wm->server;
+
+    // the page posts a form field, scripts may post the raw document
+    const String json = srv->hasArg("config") ? srv->arg("config") : srv->arg("plain");
+
+    StaticJsonDocument<1024> doc;
+    DeserializationError err = deserializeJson(doc, json);
+    if(err) {
+        log_e("Deserialze Failed: %s (%d)", err.c_str(), err.code());
+        srv->send(400, "text/plain", err.c_str());
+        return;
     }
 
+    const char *invalid;
+    if(!settings.fromJson(doc.as<JsonVariantConst>(), &invalid)) {
+        srv->send(400, "text/plain", String(F("invalid ")) + invalid);
+        return;
+    }
     settings.requestAsyncSave();
 
     srv->send_P(200, PSTR("text/html"), PSTR("<script>parent.location.href = '/';</script>"));
 }
 
+void WordClockPage::handleTimezones() {
+    auto &srv = wm->server;
+
+    // precompressed by scripts/timezone.py, goes from flash to the socket unchanged
+    srv->sendHeader(F("Content-Encoding"), F("gzip"));
+    srv->sendHeader(F("Cache-Control"), F("public, max-age=31536000, immutable"));
+    srv->send_P(200, PSTR("application/json"), reinterpret_cast<PGM_P>(timezonesJsonGz), timezonesJsonGzSize);
+}
+
+#ifdef PROFILER
+void WordClockPage::handleProfile() {
+    StreamString report;
+    profiler.report(report);
+    radio.report(report);
+    wm->server->send(200, "text/plain", report);
+}
+#endif
+
 void WordClockPage::bindServerRequests() {
     wm->server->on("/custom", std::bind(&WordClockPage::handleRoute, this));
     wm->server->on("/save-wc", std::bind(&WordClockPage::handleValues, this));
+    wm->server->on("/config.json", HTTP_GET, std::bind(&WordClockPage::handleExport, this));
+    wm->server->on("/config.json", HTTP_POST, std::bind(&WordClockPage::handleImport, this));
+    wm->server->on("/timezones.json", HTTP_GET, std::bind(&WordClockPage::handleTimezones, this));
+    restApi.bindServerRequests(wm);
+#ifdef PROFILER
+    wm->server->on("/profile", std::bind(&WordClockPage::handleProfile, this));
+#endif
 }
\ No newline at end of file
@@ -19,6 +19,12 @@ private:
     void bindServerRequests();
     void handleRoute();
     void handleValues();
+    void handleExport();
+    void handleImport();
+    void handleTimezones();
+#ifdef PROFILER
+    void handleProfile();
+#endif
 
     WiFiManager *wm;
 };
@@ -1,6 +1,206 @@
 #include "esp-hal-log.h"
 #include <Arduino.h>
 
+namespace logging {
+
+uint8_t threshold = ARDUHAL_LOG_LEVEL;
+
+namespace {
+
+    struct Header {
+        uint16_t words; // of the whole record, 0 marks the unused end of the buffer
+        uint8_t level;
+        uint8_t count;
+        uint16_t line;
+        uint32_t time;
+        PGM_P format;
+        const char *file;
+        const char *function;
+    };
+
+    constexpr size_t bufferWords = CONFIG_ARDUHAL_LOG_BUFFER_SIZE / sizeof(uint32_t);
+    constexpr size_t headerWords = (sizeof(Header) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    uint32_t buffer[bufferWords];
+    size_t head = 0; // next record is written here
+    size_t tail = 0; // oldest record
+    size_t used = 0; // words, including the skipped end of the buffer
+    uint32_t dropped = 0;
+
+    constexpr size_t words(size_t bytes) { return (bytes + sizeof(uint32_t) - 1) / sizeof(uint32_t); }
+
+    size_t stringSize(const Arg &arg) {
+        if(!arg.str)
+            return 0;
+        const size_t len = arg.type == ArgType::pstr ? strlen_P(arg.str) : strlen(arg.str);
+        return std::min<size_t>(len, CONFIG_ARDUHAL_LOG_MAX_STRING);
+    }
+
+    // in the buffer every argument is one word with its type and payload size, followed by the payload
+    size_t payloadSize(const Arg &arg) {
+        switch(arg.type) {
+            case ArgType::u32:
+            case ArgType::i32:
+                return sizeof(uint32_t);
+            case ArgType::u64:
+            case ArgType::i64:
+                return sizeof(uint64_t);
+            case ArgType::f64:
+                return sizeof(double);
+            case ArgType::str:
+            case ArgType::pstr:
+                return stringSize(arg) + 1;
+            case ArgType::ptr:
+                return sizeof(void *);
+        }
+        return 0;
+    }
+
+    uint8_t *bytes(size_t word) { return reinterpret_cast<uint8_t *>(&buffer[word]); }
+
+} // namespace
+
+void write(uint8_t level, PGM_P format, const char *file, uint16_t line, const char *function, const Arg *args, size_t count) {
+    size_t size = headerWords;
+    for(size_t i = 0; i < count; i++)
+        size += 1 + words(payloadSize(args[i]));
+
+    // records are contiguous, skip the end of the buffer if the record does not fit there
+    const size_t skip = head + size > bufferWords ? bufferWords - head : 0;
+    if(size > bufferWords || used + skip + size > bufferWords) {
+        dropped++;
+        return;
+    }
+    if(skip) {
+        if(skip >= headerWords)
+            memset(bytes(head), 0, sizeof(Header));
+        used += skip;
+        head = 0;
+    }
+
+    const Header header{uint16_t(size), level, uint8_t(count), line, uint32_t(millis()), format, file, function};
+    memcpy(bytes(head), &header, sizeof(header));
+    size_t pos = head + headerWords;
+    for(size_t i = 0; i < count; i++) {
+        const Arg &arg = args[i];
+        const size_t payload = payloadSize(arg);
+        buffer[pos++] = uint32_t(arg.type) | payload << 8;
+
+        uint8_t *dst = bytes(pos);
+        if(arg.type == ArgType::str || arg.type == ArgType::pstr) {
+            if(arg.type == ArgType::pstr)
+                memcpy_P(dst, arg.str, payload - 1);
+            else if(arg.str)
+                memcpy(dst, arg.str, payload - 1);
+            dst[payload - 1] = '\0';
+        } else
+            memcpy(dst, &arg.u64, payload);
+        pos += words(payload);
+    }
+
+    head = (head + size) % bufferWords;
+    used += size;
+}
+
+namespace {
+
+    Arg readArg(size_t &pos) {
+        Arg arg;
+        arg.type = ArgType(buffer[pos] & 0xff);
+        const size_t payload = buffer[pos++] >> 8;
+        arg.u64 = 0;
+        if(arg.type == ArgType::str || arg.type == ArgType::pstr) {
+            arg.type = ArgType::str;
+            arg.str = reinterpret_cast<const char *>(bytes(pos));
+        } else
+            memcpy(&arg.u64, bytes(pos), payload);
+        pos += words(payload);
+        return arg;
+    }
+
+    // prints one conversion, spec holds it without length modifiers, those are chosen by the type of the argument
+    void printArg(Print &out, char *spec, size_t len, char conversion, const Arg &arg) {
+        char text[64];
+        int n = -1;
+        const bool number = conversion != 's' && conversion != 'p';
+        if(conversion == 's' && arg.type == ArgType::str) {
+            spec[len++] = 's';
+            spec[len] = '\0';
+            n = snprintf(text, sizeof(text), spec, arg.str);
+        } else if(conversion == 'p' && arg.type == ArgType::ptr) {
+            spec[len++] = 'p';
+            spec[len] = '\0';
+            n = snprintf(text, sizeof(text), spec, arg.ptr);
+        } else if(number && strchr("fFeEgGaA", conversion)) {
+            spec[len++] = conversion;
+            spec[len] = '\0';
+            const double value = arg.type == ArgType::f64 ? arg.f64 : arg.type == ArgType::i32 ? arg.i32 : arg.type == ArgType::i64 ? arg.i64 : arg.u64;
+            n = snprintf(text, sizeof(text), spec, value);
+        } else if(number && arg.type != ArgType::str && arg.type != ArgType::ptr) {
+            const bool wide = arg.type == ArgType::u64 || arg.type == ArgType::i64 || arg.type == ArgType::f64;
+            if(wide) {
+                spec[len++] = 'l';
+                spec[len++] = 'l';
+            }
+            spec[len++] = conversion;
+            spec[len] = '\0';
+            if(arg.type == ArgType::f64)
+                n = snprintf(text, sizeof(text), spec, (long long)arg.f64);
+            else if(wide)
+                n = snprintf(text, sizeof(text), spec, (long long)arg.i64);
+            else
+                n = snprintf(text, sizeof(text), spec, arg.u32);
+        }
+        if(n < 0) {
+            out.print(F("(?)"));
+            return;
+        }
+        out.write(reinterpret_cast<const uint8_t *>(text), std::min<size_t>(n, sizeof(text) - 1));
+    }
+
+    void printMessage(Print &out, PGM_P format, size_t pos, size_t count) {
+        char literal[32];
+        size_t len = 0;
+        auto flushLiteral = [&]() {
+            out.write(reinterpret_cast<const uint8_t *>(literal), len);
+            len = 0;
+        };
+
+        for(char c; (c = pgm_read_byte(format)); format++) {
+            if(c != '%' || pgm_read_byte(format + 1) == '%') {
+                if(c == '%')
+                    format++;
+                literal[len++] = c;
+                if(len == sizeof(literal))
+                    flushLiteral();
+                continue;
+            }
+            flushLiteral();
+
+            // %[flags][width][.precision][length]conversion
+            char spec[16] = "%";
+            size_t specLen = 1;
+            while((c = pgm_read_byte(++format)) && strchr("-+ #0123456789.", c) && specLen < sizeof(spec) - 4)
+                spec[specLen++] = c;
+            while(c && strchr("hljztL", c))
+                c = pgm_read_byte(++format);
+            if(!c)
+                break;
+
+            if(count) {
+                const Arg arg = readArg(pos);
+                count--;
+                printArg(out, spec, specLen, c, arg);
+            } else
+                out.print(F("(?)"));
+        }
+        flushLiteral();
+    }
+
+} // namespace
+
+} // namespace logging
+
 const char *pathToFileName(const char *path) {
     size_t i = 0;
     size_t pos = 0;
@@ -15,24 +215,46 @@ const char *pathToFileName(const char *path) {
     return path + pos;
 }
 
-int log_printf(PGM_P fmt, ...) {
-    va_list arg;
-    char temp[64];
-    char *buffer = temp;
-
-    va_start(arg, fmt);
-    size_t len = vsnprintf_P(temp, sizeof(temp), fmt, arg);
-    va_end(arg);
-    if(len > sizeof(temp) - 1) {
-        buffer = new char[len + 1];
-        if(!buffer)
-            return 0;
-        va_start(arg, fmt);
-        vsnprintf_P(buffer, len + 1, fmt, arg);
-        va_end(arg);
-    }
-    len = Serial.write((const uint8_t *)buffer, len);
-    if(buffer != temp)
-        delete[] buffer;
-    return len;
+size_t log_drain(Print &out) {
+    using namespace logging;
+
+#if CONFIG_ARDUHAL_LOG_COLORS
+    static const char *const colors[] = {"", ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_RED), ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_YELLOW),
+                                         ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_GREEN), ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_CYAN),
+                                         ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_GRAY)};
+#endif
+
+    size_t records = 0;
+    while(used) {
+        Header header;
+        if(bufferWords - tail < headerWords || (memcpy(&header, bytes(tail), sizeof(header)), header.words == 0)) {
+            // skipped end of the buffer
+            used -= bufferWords - tail;
+            tail = 0;
+            continue;
+        }
+
+        char prefix[64];
+        const uint8_t level = std::min<uint8_t>(header.level, ARDUHAL_LOG_LEVEL_VERBOSE);
+        const int n = snprintf(prefix, sizeof(prefix), "%s[%6u][%c][%s:%u] %s(): ",
+#if CONFIG_ARDUHAL_LOG_COLORS
+                               colors[level],
+#else
+                               "",
+#endif
+                               unsigned(header.time), "NEWIDV"[level], pathToFileName(header.file), header.line, header.function);
+        out.write(reinterpret_cast<const uint8_t *>(prefix), std::min<size_t>(n, sizeof(prefix) - 1));
+        printMessage(out, header.format, tail + headerWords, header.count);
+        out.print(F(ARDUHAL_LOG_RESET_COLOR "\r\n"));
+
+        tail = (tail + header.words) % bufferWords;
+        used -= header.words;
+        records++;
+    }
+
+    if(dropped) {
+        out.printf_P(PSTR("[%u log messages dropped]\r\n"), unsigned(dropped));
+        dropped = 0;
+    }
+    return records;
 }
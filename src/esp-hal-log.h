@@ -14,12 +14,9 @@
 #ifndef __ARDUHAL_LOG_H__
 #define __ARDUHAL_LOG_H__
 
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
 #include <pgmspace.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define ARDUHAL_LOG_LEVEL_NONE       (0)
 #define ARDUHAL_LOG_LEVEL_ERROR      (1)
@@ -43,10 +40,26 @@ extern "C"
 #endif
 #endif
 
+// a module may define LOG_LOCAL_LEVEL before its includes to log less than the rest of the firmware, see LOG_LEVEL_* in config.h
+// it is evaluated where the log macros are used, calls above it are constant false and compile to nothing
+#ifndef LOG_LOCAL_LEVEL
+#define LOG_LOCAL_LEVEL ARDUHAL_LOG_LEVEL
+#endif
+
 #ifndef CONFIG_ARDUHAL_LOG_COLORS
 #define CONFIG_ARDUHAL_LOG_COLORS 0
 #endif
 
+// size of the deferred log buffer in bytes
+#ifndef CONFIG_ARDUHAL_LOG_BUFFER_SIZE
+#define CONFIG_ARDUHAL_LOG_BUFFER_SIZE 2048
+#endif
+
+// string arguments are copied into the log buffer up to this length
+#ifndef CONFIG_ARDUHAL_LOG_MAX_STRING
+#define CONFIG_ARDUHAL_LOG_MAX_STRING 47
+#endif
+
 #if CONFIG_ARDUHAL_LOG_COLORS
 #define ARDUHAL_LOG_COLOR_BLACK   "30"
 #define ARDUHAL_LOG_COLOR_RED     "31" //ERROR
@@ -61,69 +74,149 @@ extern "C"
 #define ARDUHAL_LOG_COLOR(COLOR)  "\033[0;" COLOR "m"
 #define ARDUHAL_LOG_BOLD(COLOR)   "\033[1;" COLOR "m"
 #define ARDUHAL_LOG_RESET_COLOR   "\033[0m"
-
-#define ARDUHAL_LOG_COLOR_E       ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_RED)
-#define ARDUHAL_LOG_COLOR_W       ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_YELLOW)
-#define ARDUHAL_LOG_COLOR_I       ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_GREEN)
-#define ARDUHAL_LOG_COLOR_D       ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_CYAN)
-#define ARDUHAL_LOG_COLOR_V       ARDUHAL_LOG_COLOR(ARDUHAL_LOG_COLOR_GRAY)
-#define ARDUHAL_LOG_COLOR_PRINT(letter) log_printf(ARDUHAL_LOG_COLOR_ ## letter)
-#define ARDUHAL_LOG_COLOR_PRINT_END log_printf(ARDUHAL_LOG_RESET_COLOR)
 #else
-#define ARDUHAL_LOG_COLOR_E
-#define ARDUHAL_LOG_COLOR_W
-#define ARDUHAL_LOG_COLOR_I
-#define ARDUHAL_LOG_COLOR_D
-#define ARDUHAL_LOG_COLOR_V
-#define ARDUHAL_LOG_RESET_COLOR
-#define ARDUHAL_LOG_COLOR_PRINT(letter)
-#define ARDUHAL_LOG_COLOR_PRINT_END
+#define ARDUHAL_LOG_RESET_COLOR   ""
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
 #endif
 
 const char * pathToFileName(const char * path);
-int log_printf(PGM_P fmt, ...);
 
-#define ARDUHAL_SHORT_LOG_FORMAT(letter, format)  ARDUHAL_LOG_COLOR_ ## letter format ARDUHAL_LOG_RESET_COLOR "\r\n"
-#define ARDUHAL_LOG_FORMAT(letter, format)  (PGM_P) PSTR(ARDUHAL_LOG_COLOR_ ## letter "[%6u][" #letter "][%s:%u] %s(): " format ARDUHAL_LOG_RESET_COLOR "\r\n"), millis(), pathToFileName(__FILE__), __LINE__, __FUNCTION__
+#ifdef __cplusplus
+}
+
+#include <type_traits>
+
+class Print;
+class __FlashStringHelper;
+
+/**
+ * Deferred logging: the log macros store the format pointer and the raw arguments in a ring buffer, nothing is formatted or allocated.
+ * log_drain() formats the records and writes them out, it runs when loop() has time for it and before the clock goes to sleep.
+ * If the buffer is full new records are dropped and counted.
+ */
+namespace logging {
+
+enum class ArgType : uint8_t { u32 = 0, i32, u64, i64, f64, str, pstr, ptr };
+
+struct Arg {
+    ArgType type;
+    union {
+        uint32_t u32;
+        int32_t i32;
+        uint64_t u64;
+        int64_t i64;
+        double f64;
+        const char *str;
+        const void *ptr;
+    };
+};
+
+template <typename T, typename = typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type>
+inline Arg toArg(T value) {
+    using U = typename std::conditional<std::is_enum<T>::value, std::underlying_type<T>, std::common_type<T>>::type::type;
+    Arg arg;
+    if(sizeof(U) > sizeof(uint32_t)) {
+        arg.type = std::is_signed<U>::value ? ArgType::i64 : ArgType::u64;
+        arg.u64 = uint64_t(value);
+    } else if(std::is_signed<U>::value) {
+        arg.type = ArgType::i32;
+        arg.i32 = int32_t(value);
+    } else {
+        arg.type = ArgType::u32;
+        arg.u32 = uint32_t(value);
+    }
+    return arg;
+}
+inline Arg toArg(double value) {
+    Arg arg;
+    arg.type = ArgType::f64;
+    arg.f64 = value;
+    return arg;
+}
+inline Arg toArg(const char *value) {
+    Arg arg;
+    arg.type = ArgType::str;
+    arg.str = value;
+    return arg;
+}
+inline Arg toArg(const __FlashStringHelper *value) {
+    Arg arg;
+    arg.type = ArgType::pstr;
+    arg.str = reinterpret_cast<const char *>(value);
+    return arg;
+}
+inline Arg toArg(const void *value) {
+    Arg arg;
+    arg.type = ArgType::ptr;
+    arg.ptr = value;
+    return arg;
+}
+
+void write(uint8_t level, PGM_P format, const char *file, uint16_t line, const char *function, const Arg *args, size_t count);
+
+// runtime threshold, records above it are skipped before their arguments are evaluated
+extern uint8_t threshold;
+
+} // namespace logging
+
+// the compiled level caps the runtime threshold
+inline void log_set_level(uint8_t level) { logging::threshold = level < ARDUHAL_LOG_LEVEL ? level : ARDUHAL_LOG_LEVEL; }
+inline uint8_t log_get_level() { return logging::threshold; }
+
+template <typename... Args> inline void log_record(uint8_t level, PGM_P format, const char *file, uint16_t line, const char *function, const Args &...args) {
+    const logging::Arg list[sizeof...(Args) + 1] = {logging::toArg(args)..., {}};
+    logging::write(level, format, file, line, function, list, sizeof...(Args));
+}
+
+// format and print the buffered records, returns the number of records written
+size_t log_drain(Print &out);
+
+#define ARDUHAL_LOG_RECORD(level, format, ...)                                                                                                       \
+    do {                                                                                                                                             \
+        if(LOG_LOCAL_LEVEL >= level && logging::threshold >= level)                                                                                  \
+            log_record(level, PSTR(format), __FILE__, __LINE__, __FUNCTION__, ##__VA_ARGS__);                                                        \
+    } while(0)
 
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_VERBOSE
-#define log_v(format, ...) log_printf(ARDUHAL_LOG_FORMAT(V, format), ##__VA_ARGS__)
+#define log_v(format, ...) ARDUHAL_LOG_RECORD(ARDUHAL_LOG_LEVEL_VERBOSE, format, ##__VA_ARGS__)
 #else
 #define log_v(format, ...)  do {} while(0)
 #endif
 
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_DEBUG
-#define log_d(format, ...) log_printf(ARDUHAL_LOG_FORMAT(D, format), ##__VA_ARGS__)
+#define log_d(format, ...) ARDUHAL_LOG_RECORD(ARDUHAL_LOG_LEVEL_DEBUG, format, ##__VA_ARGS__)
 #else
 #define log_d(format, ...)  do {} while(0)
 #endif
 
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
-#define log_i(format, ...) log_printf(ARDUHAL_LOG_FORMAT(I, format), ##__VA_ARGS__)
+#define log_i(format, ...) ARDUHAL_LOG_RECORD(ARDUHAL_LOG_LEVEL_INFO, format, ##__VA_ARGS__)
 #else
 #define log_i(format, ...) do {} while(0)
 #endif
 
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_WARN
-#define log_w(format, ...) log_printf(ARDUHAL_LOG_FORMAT(W, format), ##__VA_ARGS__)
+#define log_w(format, ...) ARDUHAL_LOG_RECORD(ARDUHAL_LOG_LEVEL_WARN, format, ##__VA_ARGS__)
 #else
 #define log_w(format, ...) do {} while(0)
 #endif
 
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_ERROR
-#define log_e(format, ...) log_printf(ARDUHAL_LOG_FORMAT(E, format), ##__VA_ARGS__)
+#define log_e(format, ...) ARDUHAL_LOG_RECORD(ARDUHAL_LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
 #else
 #define log_e(format, ...) do {} while(0)
 #endif
 
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_NONE
-#define log_n(format, ...) log_printf(ARDUHAL_LOG_FORMAT(E, format), ##__VA_ARGS__)
+#define log_n(format, ...) ARDUHAL_LOG_RECORD(ARDUHAL_LOG_LEVEL_ERROR, format, ##__VA_ARGS__)
 #else
 #define log_n(format, ...) do {} while(0)
 #endif
 
-#ifdef __cplusplus
-}
-#endif
+#endif /* __cplusplus */
 
 #endif /* __ESP_LOGGING_H__ */
@@ -6,23 +6,16 @@
 #include "Language.h"
 
 class LangEng : public Language {
+    static constexpr size_t ledCount = 100;
 
 public:
     LangEng() = default;
 
     virtual void showTime(struct tm *tm) override final {
-        // show the words
-        for(auto i = 0; i < 4; i++) {
-            const auto dispIndex = pgm_read_byte_near(&displayContents[tm->tm_min / 5][i]);
-            if(dispIndex == 255) // we reached the end of the loop, skip remaining bytes
-                break;
-            showWord(dispIndex);
-        }
+        const uint8_t bucket = tm->tm_min / 5;
+        const int hour = hourFormat12((bucket < 7) ? tm->tm_hour : tm->tm_hour + 1);
 
-        if(tm->tm_min / 5 < 7)
-            showHour(hourFormat12(tm->tm_hour));
-        else
-            showHour(hourFormat12(tm->tm_hour + 1));
+        showMask(&timeMasks[timeMaskIndex(bucket, hour)]);
     }
 
     virtual void showTestWords() override final {
@@ -34,7 +27,19 @@ public:
         showHour(12);
     }
 
-    static constexpr size_t getLedCount() { return 100; }
+    virtual void showSetup() override final {
+        showWord(0);
+        showWord(1);
+        showWord(10);
+    }
+
+    virtual void showReset() override final {
+        // no dedicated letters on the english face, show "IT IS" only
+        showWord(0);
+        showWord(1);
+    }
+
+    static constexpr size_t getLedCount() { return ledCount; }
 
 
 private:
@@ -105,4 +110,21 @@ private:
         {10, 0, 1, 3, 8, 255},    // minute 50 - 54
         {11, 2, 8, 255, 255, 255} // minute 55 - 59
     };
+
+    // all possible time displays, bucket * 12 + hour slot
+    static constexpr auto timeMasks PROGMEM = makeMaskTable<ledCount, minuteBuckets * hourSlots>([](size_t index) {
+        LedMask<ledCount> mask;
+        const size_t bucket = index / hourSlots;
+        const size_t hour = (index % hourSlots == 0) ? 12 : index % hourSlots;
+
+        // skip the range in the first column
+        for(size_t i = 1; i < std::size(displayContents[bucket]); i++) {
+            const auto w = displayContents[bucket][i];
+            if(w == 255)
+                break;
+            mask.set(wordGroups[w][0], wordGroups[w][1]);
+        }
+        mask.set(hourGroups[hour][0], hourGroups[hour][1]);
+        return mask;
+    });
 };
@@ -7,29 +7,19 @@
 #include "esp-hal-log.h"
 
 class LangGer : public Language {
+    static constexpr size_t ledCount = 98;
 
 public:
     LangGer() = default;
 
     virtual void showTime(struct tm *tm) override final {
-        FastLED.clear();
-        // show the words
-        for(auto i = 0; i < 4; i++) {
-            const auto dispIndex = pgm_read_byte_near(&displayContents[tm->tm_min / 5][i]);
-            if(dispIndex == 255) // we reached the end of the loop, skip remaining bytes
-                break;
-            showWord(dispIndex);
-        }
+        const uint8_t bucket = tm->tm_min / 5;
+        const int hour = hourFormat12((bucket < 5) ? tm->tm_hour : tm->tm_hour + 1);
 
-        if(tm->tm_min / 5 < 5) {
-            if(hourFormat12(tm->tm_hour) == 1 && tm->tm_min / 5 == 0) { // Wenn "Ein Uhr", nutze "Ein" statt "Eins" aus hourGroups
-                showHour(0);
-            } else {
-                showHour(hourFormat12(tm->tm_hour));
-            }
-        } else {
-            showHour(hourFormat12(tm->tm_hour + 1));
-        }
+        if(hour == 1 && bucket == 0) // Wenn "Ein Uhr", nutze "Ein" statt "Eins" aus hourGroups
+            showMask(&timeMasks[einUhrMask]);
+        else
+            showMask(&timeMasks[timeMaskIndex(bucket, hour)]);
     }
 
     virtual void showTestWords() override final {
@@ -54,7 +44,7 @@ public:
         leds[41] = leds[33] = leds[34] = leds[45] = leds[30] = markerHSV;
     }
 
-    static constexpr size_t getLedCount() { return 98; }
+    static constexpr size_t getLedCount() { return ledCount; }
 
 private:
     void showWord(uint8_t w) {
@@ -123,4 +113,21 @@ private:
         {0, 1, 3, 7},     // minute 50 - 54
         {2, 7, 255, 255}  // minute 55 - 59
     };
+
+    static constexpr size_t einUhrMask = minuteBuckets * hourSlots;
+
+    // all possible time displays, bucket * 12 + hour slot, the last entry is "ES IST EIN UHR"
+    static constexpr auto timeMasks PROGMEM = makeMaskTable<ledCount, einUhrMask + 1>([](size_t index) {
+        LedMask<ledCount> mask;
+        const size_t bucket = (index == einUhrMask) ? 0 : index / hourSlots;
+        const size_t hour = (index == einUhrMask) ? 0 : (index % hourSlots == 0) ? 12 : index % hourSlots;
+
+        for(const auto w : displayContents[bucket]) {
+            if(w == 255)
+                break;
+            mask.set(wordGroups[w][0], wordGroups[w][1]);
+        }
+        mask.set(hourGroups[hour][0], hourGroups[hour][1]);
+        return mask;
+    });
 };
@@ -1,20 +1,23 @@
+#define LOG_LOCAL_LEVEL LOG_LEVEL_MAIN // see config.h
 
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
 #include <FastLED.h>
-#include <LittleFS.h>
-#include <RTCMemory.h>
 #include <Schedule.h>
 #include <WiFiManager.h>
 #include <coredecls.h>
 
 #include "c++23.h"
 
+#include "Benchmark.h"
 #include "Button.h"
+#include "Profiler.h"
+#include "Radio.h"
 #include "config.h"
 #include "esp-hal-log.h"
 #include "pins.h"
 
+#include "RtcState.h"
 #include "Settings.h"
 #include "WordClock.h"
 #include "WordClockPage.h"
@@ -24,28 +27,23 @@ constexpr SerialConfig serialConfig = SERIAL_8N1;
 constexpr SerialMode serialMode = SERIAL_FULL;
 constexpr const char *wmProtalName PROGMEM = "WordClock Setup";
 
-struct WiFiState {
-    uint32_t crc;
-    struct {
-        station_config fwconfig;
-        ip_info ip;
-        ip_addr_t dns[2];
-        ip_addr_t ntp[2];
-        WiFiMode_t mode;
-        uint8_t channel;
-        bool persistent;
-    } state;
-};
-
-struct RtcData {
-    WiFiState stateSave;
-    time_t now;
-};
-
 Button buttonA;
 Button buttonB;
 WiFiManager wm;
-RTCMemory<RtcData> rtcMemory;
+
+enum class PowerState : uint8_t { awake, draining, arming, sleeping, resuming };
+PowerState powerState{PowerState::awake};
+volatile bool wokeUp{false};
+
+// measured durations of the last wake cycle in µs
+struct {
+    uint32_t start;
+    uint32_t awake;
+    uint32_t drain;
+    uint32_t arm;
+    uint32_t resume;
+    uint16_t armRetries;
+} powerTimes;
 
 inline void setupSerial() { Serial.begin(serialBaud, serialConfig, serialMode); }
 
@@ -64,10 +62,7 @@ void buttonBPressed() {
 void buttonALongPress() {
     if(buttonB.longPress()) {
         // start wifi manager
-        WiFi.resumeFromShutdown(rtcMemory.getData()->stateSave);
-
-        wordClock.setSetup(&wm);
-        wm.startConfigPortal(wmProtalName);
+        radio.startPortal();
     } else {
         // adjust clock by +1 hour
     }
@@ -83,11 +78,54 @@ void buttonBLongPress() {
 
 RF_PRE_INIT() { system_phy_set_powerup_option(2); }
 
+#ifdef DEEP_SLEEP
+[[noreturn]] void enterDeepSleep() {
+    const uint32_t seconds = wordClock.prepareAlarm();
+    wordClock.saveState(rtcMemory.getData()->clock);
+    PROFILE_MARK(sleepPrep);
+    PROFILE_END_CYCLE();
+    rtcMemory.save();
+
+    log_d("deep sleep for %u s", seconds);
+    log_drain(Serial);
+    Serial.flush();
+
+    // the DS3231 alarm should reset us first, the timer (GPIO16 to RST) is the fallback
+    const bool sync = wordClock.syncDue(time(nullptr) + seconds);
+    ESP.deepSleep((seconds + 1) * 1000000ull, sync ? WAKE_RF_DEFAULT : WAKE_RF_DISABLED);
+    while(1) {
+        yield();
+    }
+}
+#endif
+
 void setup() {
+#ifdef DEEP_SLEEP
+    // woken up for a display update: render and go back to sleep, without serial, file system or WiFi
+    if(ESP.getResetInfoPtr()->reason == REASON_DEEP_SLEEP_AWAKE && rtcMemory.begin() && settings.loadFromRtc()
+       && wordClock.resume(rtcMemory.getData()->clock)) {
+#ifdef PROFILER
+        profiler.begin(&rtcMemory.getData()->profile);
+#endif
+        do {
+            wordClock.loop();
+            PROFILE_MARK(clock);
+            if(const auto idle = wordClock.idleTime())
+                delay(idle);
+            PROFILE_MARK(idle);
+        } while(wordClock.isBusy());
+        enterDeepSleep();
+    }
+#endif
+
     setupSerial();
     rtcMemory.begin();
+#ifdef PROFILER
+    profiler.begin(&rtcMemory.getData()->profile);
+#endif
 
-    WiFi.shutdown(rtcMemory.getData()->stateSave);
+    // the radio stays off until the first NTP sync is due, which is right away after a power up
+    radio.begin(&wm, wmProtalName);
 
     log_i(SKETCHNAME " starting up...");
     log_i("Clock type: " CLOCKNAME);
@@ -117,19 +155,6 @@ void setup() {
     log_i("Time based night mode enabled");
 #endif
 
-    if(!LittleFS.begin()) {
-        log_w("File system failed to mount. Formatting...");
-        bool ret = LittleFS.format();
-        ret &= LittleFS.begin();
-        if(!ret) {
-            log_e("failed to format & mount file system!");
-            while(1) {
-                yield();
-            }
-        }
-    }
-    log_i("Filesystem mounted");
-
     if(settings.loadSettings())
         log_i("Settings loaded");
     else {
@@ -168,20 +193,21 @@ void setup() {
         // we delayed already 5s, if the buttons are still pressed, reset
         if(buttonA.pressedRaw() && buttonB.pressedRaw()) {
             wm.resetSettings();
+            log_drain(Serial);
             ESP.restart();
         }
     }
 
-    if(settings.wifiEnable) {
-        log_i("Wifi manager started");
-        WiFi.resumeFromShutdown(rtcMemory.getData()->stateSave);
-        wm.autoConnect(wmProtalName);
-    }
-
     log_i("Setup finished");
+    log_drain(Serial);
+
+#ifdef WORDCLOCK_BENCH
+    Benchmark::run(Serial);
+#endif
 }
 
 void IRAM_ATTR wakeupCallback() {
+    wokeUp = true;
     wordClock.getTimeFromRtc();
     schedule_function([]() { log_d("Callback"); });
 }
@@ -189,6 +215,7 @@ void IRAM_ATTR wakeupCallback() {
 void IRAM_ATTR wakeupPinIsrWE() {
     // Wakeup IRQs are available as level-triggered only.
     detachInterrupt(RTCINT_PIN);
+    wokeUp = true;
     schedule_function([]() { log_d("GPIO wakeup IRQ"); });
 }
 
@@ -197,18 +224,119 @@ uint32_t get_millisecond_timer() {
     return (system_get_rtc_time() * (system_rtc_clock_cali_proc() >> 12)) / 1000;
 }
 
-void loop() {
-    static bool busy = true;
-    static CEveryNMillis resetBusy(500);
-    if(resetBusy)
-        busy = false;
+bool subsystemsBusy() {
+    return wordClock.isBusy() || settings.isBusy() || buttonA.isBusy() || buttonB.isBusy() || radio.isBusy();
+}
+
+void lightSleep(uint32_t seconds) {
+    log_d("preparing for sleep");
+    log_drain(Serial);
+    Serial.flush();
+
+    // the radio is already shut down, it is only up while Radio is busy
+    wifi_fpm_close();
+    wifi_set_opmode(NULL_MODE);
+    wifi_fpm_set_sleep_type(LIGHT_SLEEP_T);
+    wifi_fpm_open();
+    wifi_fpm_set_wakeup_cb(wakeupCallback);
+    wokeUp = false;
+    attachInterrupt(RTCINT_PIN, wakeupPinIsrWE, ONLOW_WE);
+    buttonA.armWakeup();
+    buttonB.armWakeup();
+    PROFILE_MARK(sleepPrep);
+    wifi_fpm_do_sleep(0xFFFFFFFF);
 
+    // the chip enters light sleep from the idle task, give it 1 ms slices until a wake-up source fired
+    esp_delay((seconds + 1) * 1000, []() { return !wokeUp; }, 1);
+}
+
+void resume() {
+    detachInterrupt(RTCINT_PIN);
+    buttonA.disarmWakeup();
+    buttonB.disarmWakeup();
+
+    log_d("woke up");
+    wordClock.printDebugTime();
+}
+
+/**
+ * Power state machine, runs once at the end of every loop() pass.
+ * awake:     every subsystem had at least one pass since the wake-up, stay until none of them is busy
+ * draining:  write out the buffered log and flush the serial output
+ * arming:    program the RTC alarm, retry on the next pass while an alarm still pulls INT low
+ * sleeping:  radio off, wake-up sources armed, light sleep until one of them fires
+ * resuming:  release the wake-up sources, the radio stays off until Radio needs it
+ */
+void powerLoop() {
+    if(powerState != PowerState::awake && subsystemsBusy()) {
+        powerState = PowerState::awake;
+        return;
+    }
+
+    uint32_t now = micros();
+    switch(powerState) {
+        case PowerState::awake:
+            if(subsystemsBusy())
+                break;
+            powerTimes.awake = now - powerTimes.start;
+            powerState = PowerState::draining;
+            [[fallthrough]];
+
+        case PowerState::draining:
+            log_drain(Serial);
+            Serial.flush();
+            powerTimes.drain = micros() - now;
+            powerTimes.armRetries = 0;
+            powerState = PowerState::arming;
+            [[fallthrough]];
+
+        case PowerState::arming: {
+            now = micros();
+#ifdef DEEP_SLEEP
+            enterDeepSleep();
+#endif
+            const uint32_t seconds = wordClock.prepareAlarm();
+            if(!digitalRead(RTCINT_PIN)) {
+                powerTimes.armRetries++;
+                break;
+            }
+            powerTimes.arm = micros() - now;
+            log_d("awake %u us, drain %u us, arm %u us (%u retries), resume %u us", powerTimes.awake, powerTimes.drain, powerTimes.arm,
+                  powerTimes.armRetries, powerTimes.resume);
+
+            powerState = PowerState::sleeping;
+            lightSleep(seconds);
+            powerState = PowerState::resuming;
+        }
+            [[fallthrough]];
+
+        case PowerState::resuming:
+            now = micros();
+            resume();
+            PROFILE_MARK(sleep);
+            PROFILE_END_CYCLE();
+            powerTimes.start = micros();
+            powerTimes.resume = powerTimes.start - now;
+            powerState = PowerState::awake;
+            break;
+
+        case PowerState::sleeping:
+            break;
+    }
+}
+
+void loop() {
     wm.process();
+    radio.loop();
+    PROFILE_MARK(wifi);
 
     wordClock.loop();
+    PROFILE_MARK(clock);
     settings.loop();
+    PROFILE_MARK(settings);
     buttonA.loop();
     buttonB.loop();
+    PROFILE_MARK(buttons);
 
     static CEveryNSeconds debugHeap(10);
     if(debugHeap)
@@ -218,37 +346,20 @@ void loop() {
     if(printTime)
         wordClock.printDebugTime();
 
-    // don't go to sleep if any subroutine is still working
-    if(busy | wordClock.isBusy() || buttonA.isBusy() || buttonB.isBusy() || wm.getConfigPortalActive())
-        return;
-
-    wordClock.latchAlarmflags();
-    while(!digitalRead(RTCINT_PIN)) {
-        log_d("wait for INT-HIGH");
-        delay(1);
+#ifdef PROFILER
+    if(Serial.available() && Serial.read() == 'p') {
+        profiler.report(Serial);
+        radio.report(Serial);
     }
-    log_d("preparing for sleep");
-    Serial.flush();
-
-    WiFi.shutdown(rtcMemory.getData()->stateSave);
-    wifi_fpm_close();
-    wifi_set_opmode(NULL_MODE);
-    wifi_fpm_set_sleep_type(LIGHT_SLEEP_T);
-    wifi_fpm_open();
-    wifi_fpm_set_wakeup_cb(wakeupCallback);
-    attachInterrupt(RTCINT_PIN, wakeupPinIsrWE, ONLOW_WE);
-    buttonA.armWakeup();
-    buttonB.armWakeup();
-    wifi_fpm_do_sleep(0xFFFFFFFF);
-    delay(100);
-
-    if(settings.wifiEnable)
-        WiFi.resumeFromShutdown(rtcMemory.getData()->stateSave);
+#endif
+    // the log records of this pass
+    log_drain(Serial);
+    PROFILE_MARK(debug);
 
-    log_d("woke up");
-    wordClock.printDebugTime();
-    wordClock.prepareAlarm();
+    // nothing to do until the next fade frame is due, idle meanwhile
+    if(const auto idle = wordClock.idleTime())
+        delay(idle);
+    PROFILE_MARK(idle);
 
-    resetBusy.reset();
-    busy = true;
-}
\ No newline at end of file
+    powerLoop();
+}
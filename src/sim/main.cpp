@@ -0,0 +1,133 @@
+/*
+ * Host simulator for the word clock, only built by the native environment.
+ *
+ *   sim render                    print the lit LEDs of every time display of both languages
+ *   sim bench                     run the hot path benchmarks, see Benchmark.h
+ *   sim run [options]             run WordClock::loop() against the simulated clock
+ *       --start <epoch>           UTC start time (default 2023-01-01 00:00:00)
+ *       --minutes <n>             simulated duration (default one day)
+ *       --step <ms>               time between two loop() calls (default 1000)
+ *       --quiet                   only print the summary
+ */
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include <Schedule.h>
+#include <chrono>
+#include <cstring>
+
+#include "../Benchmark.h"
+#include "../Settings.h"
+#include "../WordClock.h"
+#include "../esp-hal-log.h"
+#include "../langs/lang_eng.h"
+#include "../langs/lang_ger.h"
+
+// pio test -e native links the clock logic into the test programs, they bring their own main()
+#ifndef PIO_UNIT_TESTING
+
+namespace {
+
+void printFrame(const CRGB *leds, size_t size) {
+    for(size_t i = 0; i < size; i++) {
+        if(leds[i])
+            printf(" %zu", i);
+    }
+    printf("\n");
+}
+
+template <class Lang> void renderAll(const char *name) {
+    CRGB leds[Lang::getLedCount()];
+    Lang lang;
+    lang.assign(leds, Lang::getLedCount());
+
+    for(int hour = 0; hour < 24; hour++) {
+        for(int minute = 0; minute < 60; minute += 5) {
+            struct tm tm = {};
+            tm.tm_hour = hour;
+            tm.tm_min = minute;
+            lang.showTime(&tm);
+            printf("%s %02d:%02d:", name, hour, minute);
+            printFrame(leds, Lang::getLedCount());
+        }
+    }
+}
+
+int run(int argc, char **argv) {
+    time_t start = 1672531200;
+    uint32_t minutes = 24 * 60;
+    uint32_t step = 1000;
+    bool quiet = false;
+    int paletteCycle = -1;
+
+    for(int i = 0; i < argc; i++) {
+        if(!strcmp(argv[i], "--start") && i + 1 < argc)
+            start = atoll(argv[++i]);
+        else if(!strcmp(argv[i], "--minutes") && i + 1 < argc)
+            minutes = atol(argv[++i]);
+        else if(!strcmp(argv[i], "--step") && i + 1 < argc)
+            step = std::max(1l, atol(argv[++i]));
+        else if(!strcmp(argv[i], "--quiet"))
+            quiet = true;
+        else if(!strcmp(argv[i], "--palette-cycle") && i + 1 < argc)
+            paletteCycle = atoi(argv[++i]);
+    }
+
+    sim::setEpoch(start);
+    settings.loadSettings();
+    if(paletteCycle >= 0)
+        settings.paletteCycle = paletteCycle;
+    wordClock.begin();
+
+    const uint64_t loops = uint64_t(minutes) * 60 * 1000 / step;
+    uint32_t shows = FastLED.getShowCount();
+    const auto hostStart = std::chrono::steady_clock::now();
+
+    for(uint64_t i = 0; i < loops; i++) {
+        wordClock.loop();
+        settings.loop();
+        run_scheduled_functions();
+        log_drain(Serial);
+
+        if(!quiet && FastLED.getShowCount() != shows) {
+            const time_t now = time(nullptr);
+            struct tm tm;
+            char buf[32];
+            localtime_r(&now, &tm);
+            strftime(buf, sizeof(buf), "%F %T", &tm);
+            printf("%s:", buf);
+            printFrame(FastLED.getShownFrame(), FastLED.size());
+        }
+        shows = FastLED.getShowCount();
+        sim::advanceMillis(step);
+    }
+
+    const std::chrono::duration<double> hostTime = std::chrono::steady_clock::now() - hostStart;
+    printf("loops: %llu, shows: %u, host time: %.3f s, %.0f loops/s\n", (unsigned long long)loops, FastLED.getShowCount(), hostTime.count(),
+           loops / hostTime.count());
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if(argc > 1 && !strcmp(argv[1], "render")) {
+        renderAll<LangGer>("ger");
+        renderAll<LangEng>("eng");
+        return 0;
+    }
+    if(argc > 1 && !strcmp(argv[1], "bench")) {
+        settings.loadSettings();
+        wordClock.begin();
+        log_drain(Serial);
+        Benchmark::run(Serial);
+        return 0;
+    }
+    if(argc > 1 && !strcmp(argv[1], "run"))
+        return run(argc - 2, argv + 2);
+
+    printf("usage: %s render|bench|run [--start <epoch>] [--minutes <n>] [--step <ms>] [--palette-cycle <s>] [--quiet]\n", argv[0]);
+    return 1;
+}
+
+#endif
@@ -0,0 +1,217 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <coredecls.h>
+#include <unity.h>
+
+#include "RtcState.h"
+#include "Settings.h"
+#include "genTimezone.h"
+
+// the files Settings keeps in LittleFS, HostSim puts them below .littlefs in the working directory
+constexpr const char *cfgFile = "/config/wordclock.bin";
+constexpr const char *jsonCfgFile = "/config/wordclock.json";
+
+size_t legacyIndex(const char *name) {
+    for(size_t i = 0; i < timezoneLegacySize; i++) {
+        if(timezoneFromLegacy(i) == findTimezone(name))
+            return i;
+    }
+    return timezoneLegacySize;
+}
+
+// the settings every record version can hold, as written by an older firmware
+SettingsRecord sampleRecord() {
+    SettingsRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.palette = 3;
+    rec.brightness = std::to_underlying(Brightness::high);
+    rec.flags = SettingsRecord::ntpEnabled | SettingsRecord::nmEnable;
+    rec.timezone = legacyIndex("America/New_York");
+    rec.syncInterval = 24 * 60;
+    strcpy(rec.ntpServer, "time.example.org");
+    rec.nmStartHour = 21;
+    rec.nmStartMinute = 30;
+    rec.nmEndHour = 7;
+    rec.nmEndMinute = 15;
+    rec.latitude = 4071;
+    rec.longitude = -7401;
+    rec.writeCount = 7;
+    strcpy(rec.timezoneName, "America/New_York");
+    rec.logLevel = ARDUHAL_LOG_LEVEL_WARN;
+    rec.paletteCycle = 300;
+    return rec;
+}
+
+// stores the first size bytes of rec with the CRC at their end, like the firmware of that version did
+void writeRecord(SettingsRecord rec, uint16_t version, size_t size) {
+    rec.magic = SettingsRecord::magicValue;
+    rec.version = version;
+    rec.size = size;
+
+    uint8_t bytes[sizeof(rec)];
+    memcpy(bytes, &rec, size - sizeof(uint32_t));
+    const uint32_t crc = crc32(bytes, size - sizeof(uint32_t));
+    memcpy(bytes + size - sizeof(crc), &crc, sizeof(crc));
+
+    File f = LittleFS.open(cfgFile, "w");
+    f.write(bytes, size);
+    f.close();
+}
+
+void writeFile(const char *path, const char *content) {
+    File f = LittleFS.open(path, "w");
+    f.print(content);
+    f.close();
+}
+
+void assertSample() {
+    TEST_ASSERT_EQUAL(3, settings.palette);
+    TEST_ASSERT_EQUAL(std::to_underlying(Brightness::high), std::to_underlying(settings.brightness));
+    TEST_ASSERT_FALSE(settings.wifiEnable);
+    TEST_ASSERT_TRUE(settings.ntpEnabled);
+    TEST_ASSERT_EQUAL_STRING("America/New_York", timezoneName(settings.timezone));
+    TEST_ASSERT_EQUAL_UINT32(24 * 60, settings.syncInterval);
+    TEST_ASSERT_EQUAL_STRING("time.example.org", settings.ntpServer.c_str());
+    TEST_ASSERT_TRUE(settings.nmEnable);
+    TEST_ASSERT_FALSE(settings.nmAutomatic);
+    TEST_ASSERT_EQUAL(21, settings.nmStartTime.hour);
+    TEST_ASSERT_EQUAL(30, settings.nmStartTime.minute);
+    TEST_ASSERT_EQUAL(7, settings.nmEndTime.hour);
+    TEST_ASSERT_EQUAL(15, settings.nmEndTime.minute);
+    TEST_ASSERT_EQUAL(4071, settings.latitude);
+    TEST_ASSERT_EQUAL(-7401, settings.longitude);
+}
+
+// fields a version did not have yet come from the defaults
+void assertVersion(uint16_t version) {
+    TEST_ASSERT_EQUAL_UINT32(version >= 2 ? 7 : 0, settings.getWriteCount());
+    TEST_ASSERT_EQUAL(version >= 4 ? ARDUHAL_LOG_LEVEL_WARN : ARDUHAL_LOG_LEVEL_VERBOSE, settings.logLevel);
+    TEST_ASSERT_EQUAL(version >= 5 ? 300 : 0, settings.paletteCycle);
+}
+
+void setUp() {
+    // no RTC copy and no files, as after a power cycle with an empty flash
+    Settings::resetSettings();
+}
+
+void tearDown() { }
+
+void test_record_v1() {
+    writeRecord(sampleRecord(), 1, SettingsRecord::sizeV1);
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    assertSample();
+    assertVersion(1);
+}
+
+void test_record_v2() {
+    writeRecord(sampleRecord(), 2, SettingsRecord::sizeV2);
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    assertSample();
+    assertVersion(2);
+}
+
+void test_record_v3() {
+    // from here on the time zone goes by name, the legacy index is ignored
+    SettingsRecord rec = sampleRecord();
+    rec.timezone = 0;
+    writeRecord(rec, 3, SettingsRecord::sizeV3);
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    assertSample();
+    assertVersion(3);
+}
+
+void test_record_v4() {
+    writeRecord(sampleRecord(), 4, SettingsRecord::sizeV4);
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    assertSample();
+    assertVersion(4);
+}
+
+void test_record_current() {
+    writeRecord(sampleRecord(), SettingsRecord::currentVersion, sizeof(SettingsRecord));
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    assertSample();
+    assertVersion(SettingsRecord::currentVersion);
+}
+
+void test_record_save_and_reload() {
+    writeRecord(sampleRecord(), 2, SettingsRecord::sizeV2);
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    settings.paletteCycle = 60;
+    settings.saveSettings();
+
+    // written in the current version, read back from flash instead of the RTC copy
+    rtcMemory.getData()->settings.magic = 0;
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    assertSample();
+    TEST_ASSERT_EQUAL(60, settings.paletteCycle);
+    TEST_ASSERT_EQUAL_UINT32(8, settings.getWriteCount());
+}
+
+void test_record_corrupt() {
+    writeRecord(sampleRecord(), 4, SettingsRecord::sizeV4);
+    File f = LittleFS.open(cfgFile, "r+");
+    f.seek(offsetof(SettingsRecord, palette));
+    f.write(uint8_t(4));
+    f.close();
+
+    TEST_ASSERT_FALSE(settings.loadSettings());
+    TEST_ASSERT_EQUAL(0, settings.palette);
+    TEST_ASSERT_EQUAL_STRING("europe.pool.ntp.org", settings.ntpServer.c_str());
+}
+
+void test_record_wrong_size() {
+    // a version 4 record with the size of version 3
+    writeRecord(sampleRecord(), 4, SettingsRecord::sizeV3);
+    TEST_ASSERT_FALSE(settings.loadSettings());
+    TEST_ASSERT_EQUAL(0, settings.palette);
+}
+
+void test_json_migration() {
+    char json[512];
+    snprintf(json, sizeof(json),
+             R"({"brightness":2,"palette":3,"timezone":%u,"wifi":false,"ntp-enabled":true,"ntp-server":"time.example.org",)"
+             R"("ntp-interval":1440,"nm-endable":true,"nm-automatic":false,"nm-start":{"hour":21,"minute":30},)"
+             R"("nm-end":{"hour":7,"minute":15},"nm-latitude":4071,"nm-longitude":-7401})",
+             unsigned(legacyIndex("America/New_York")));
+    writeFile(jsonCfgFile, json);
+
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    assertSample();
+    TEST_ASSERT_FALSE(LittleFS.exists(jsonCfgFile));
+    TEST_ASSERT_TRUE(LittleFS.exists(cfgFile));
+
+    // the migrated record is read on the next start
+    rtcMemory.getData()->settings.magic = 0;
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    TEST_ASSERT_EQUAL_STRING("America/New_York", timezoneName(settings.timezone));
+    TEST_ASSERT_EQUAL(4071, settings.latitude);
+}
+
+void test_json_migration_drops_invalid() {
+    // the old setup page stored 1140 for daily, the rest of the file is still taken over
+    writeFile(jsonCfgFile, R"({"palette":42,"ntp-interval":1140,"ntp-server":"time.example.org","nm-latitude":12345,"nm-longitude":-7401})");
+
+    TEST_ASSERT_TRUE(settings.loadSettings());
+    TEST_ASSERT_EQUAL(0, settings.palette);
+    TEST_ASSERT_EQUAL_UINT32(720, settings.syncInterval);
+    TEST_ASSERT_EQUAL(DEFAULT_LATITUDE, settings.latitude);
+    TEST_ASSERT_EQUAL_STRING("time.example.org", settings.ntpServer.c_str());
+    TEST_ASSERT_EQUAL(-7401, settings.longitude);
+    TEST_ASSERT_FALSE(LittleFS.exists(jsonCfgFile));
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_record_v1);
+    RUN_TEST(test_record_v2);
+    RUN_TEST(test_record_v3);
+    RUN_TEST(test_record_v4);
+    RUN_TEST(test_record_current);
+    RUN_TEST(test_record_save_and_reload);
+    RUN_TEST(test_record_corrupt);
+    RUN_TEST(test_record_wrong_size);
+    RUN_TEST(test_json_migration);
+    RUN_TEST(test_json_migration_drops_invalid);
+    return UNITY_END();
+}
@@ -0,0 +1,138 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include "NightSchedule.h"
+#include "Settings.h"
+#include "Solar.h"
+
+// published sunrise and sunset in UTC minutes, the NOAA approximation is good to a minute or two
+constexpr int tolerance = 2;
+constexpr int16_t berlinLatitude = 5252;
+constexpr int16_t berlinLongitude = 1341;
+constexpr int16_t svalbardLatitude = 7822; // Longyearbyen
+constexpr int16_t svalbardLongitude = 1565;
+
+// 0 based day of the year, 2023 is no leap year
+constexpr uint16_t jan1 = 0;
+constexpr uint16_t mar20 = 78;
+constexpr uint16_t jun21 = 171;
+constexpr uint16_t dec21 = 354;
+
+struct tm localTime(int month, int day, int hour, int minute, int second = 0) {
+    struct tm tm = {};
+    tm.tm_year = 2023 - 1900;
+    tm.tm_mon = month - 1;
+    tm.tm_mday = day;
+    tm.tm_hour = hour;
+    tm.tm_min = minute;
+    tm.tm_sec = second;
+    tm.tm_isdst = -1;
+    mktime(&tm);
+    return tm;
+}
+
+void setUp() {
+    settings.loadDefaults();
+    setTZ("CET-1CEST,M3.5.0,M10.5.0/3");
+}
+
+void tearDown() { }
+
+void test_berlin_winter() {
+    const solar::SunTimes sun = solar::calculate(jan1, berlinLatitude, berlinLongitude);
+    TEST_ASSERT_INT_WITHIN(tolerance, 7 * 60 + 17, sun.sunrise);
+    TEST_ASSERT_INT_WITHIN(tolerance, 15 * 60 + 2, sun.sunset);
+}
+
+void test_berlin_summer() {
+    const solar::SunTimes sun = solar::calculate(jun21, berlinLatitude, berlinLongitude);
+    TEST_ASSERT_INT_WITHIN(tolerance, 2 * 60 + 43, sun.sunrise);
+    TEST_ASSERT_INT_WITHIN(tolerance, 19 * 60 + 33, sun.sunset);
+}
+
+void test_svalbard_polar() {
+    const solar::SunTimes summer = solar::calculate(jun21, svalbardLatitude, svalbardLongitude);
+    TEST_ASSERT_TRUE(summer.isPolarDay());
+    TEST_ASSERT_FALSE(summer.isPolarNight());
+
+    const solar::SunTimes winter = solar::calculate(dec21, svalbardLatitude, svalbardLongitude);
+    TEST_ASSERT_TRUE(winter.isPolarNight());
+    TEST_ASSERT_FALSE(winter.isPolarDay());
+
+    const solar::SunTimes equinox = solar::calculate(mar20, svalbardLatitude, svalbardLongitude);
+    TEST_ASSERT_FALSE(equinox.isPolarDay() || equinox.isPolarNight());
+}
+
+void test_sun_times_match_calculation() {
+    // the flash table of the default location has to give the same times
+    for(uint16_t day = 0; day < 366; day++) {
+        const solar::SunTimes table = solar::sunTimes(day, DEFAULT_LATITUDE, DEFAULT_LONGITUDE);
+        const solar::SunTimes calculated = solar::calculate(day, DEFAULT_LATITUDE, DEFAULT_LONGITUDE);
+        TEST_ASSERT_EQUAL_INT16(calculated.sunrise, table.sunrise);
+        TEST_ASSERT_EQUAL_INT16(calculated.sunset, table.sunset);
+    }
+}
+
+void test_window_across_midnight() {
+    settings.nmAutomatic = false;
+    settings.nmStartTime = {22, 0};
+    settings.nmEndTime = {6, 0};
+    NightSchedule schedule;
+
+    TEST_ASSERT_TRUE(schedule.isNight(localTime(1, 1, 23, 30)));
+    TEST_ASSERT_TRUE(schedule.isNight(localTime(1, 1, 0, 0)));
+    TEST_ASSERT_TRUE(schedule.isNight(localTime(1, 1, 5, 59)));
+    TEST_ASSERT_FALSE(schedule.isNight(localTime(1, 1, 6, 0)));
+    TEST_ASSERT_FALSE(schedule.isNight(localTime(1, 1, 21, 59)));
+
+    // the next change lies after midnight
+    TEST_ASSERT_EQUAL_UINT32((6 * 60 + 30) * 60 - 15, schedule.secondsToNextChange(localTime(1, 1, 23, 30, 15)));
+    TEST_ASSERT_EQUAL_UINT32(30, schedule.secondsToNextChange(localTime(1, 1, 21, 59, 30)));
+    TEST_ASSERT_EQUAL_UINT32(16 * 60 * 60, schedule.secondsToNextChange(localTime(1, 1, 6, 0)));
+}
+
+void test_automatic_berlin() {
+    settings.nmAutomatic = true;
+    settings.latitude = berlinLatitude;
+    settings.longitude = berlinLongitude;
+    NightSchedule schedule;
+
+    // from sunset to sunrise in local time, CET in winter and CEST in summer
+    TEST_ASSERT_TRUE(schedule.isNight(localTime(1, 1, 20, 0)));
+    TEST_ASSERT_INT_WITHIN(tolerance, 16 * 60 + 2, schedule.getStartMinute());
+    TEST_ASSERT_INT_WITHIN(tolerance, 8 * 60 + 17, schedule.getEndMinute());
+    TEST_ASSERT_FALSE(schedule.isNight(localTime(1, 1, 12, 0)));
+
+    TEST_ASSERT_FALSE(schedule.isNight(localTime(6, 21, 12, 0)));
+    TEST_ASSERT_INT_WITHIN(tolerance, 21 * 60 + 33, schedule.getStartMinute());
+    TEST_ASSERT_INT_WITHIN(tolerance, 4 * 60 + 43, schedule.getEndMinute());
+}
+
+void test_automatic_polar() {
+    settings.nmAutomatic = true;
+    settings.latitude = svalbardLatitude;
+    settings.longitude = svalbardLongitude;
+    NightSchedule schedule;
+
+    // midnight sun, no night mode at all and nothing to change for a whole day
+    TEST_ASSERT_FALSE(schedule.isNight(localTime(6, 21, 0, 0)));
+    TEST_ASSERT_FALSE(schedule.isNight(localTime(6, 21, 12, 0)));
+    TEST_ASSERT_EQUAL_UINT32(12 * 60 * 60, schedule.secondsToNextChange(localTime(6, 21, 12, 0)));
+
+    // polar night, night mode all day
+    TEST_ASSERT_TRUE(schedule.isNight(localTime(12, 21, 0, 0)));
+    TEST_ASSERT_TRUE(schedule.isNight(localTime(12, 21, 12, 0)));
+    TEST_ASSERT_TRUE(schedule.isNight(localTime(12, 21, 23, 59)));
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_berlin_winter);
+    RUN_TEST(test_berlin_summer);
+    RUN_TEST(test_svalbard_polar);
+    RUN_TEST(test_sun_times_match_calculation);
+    RUN_TEST(test_window_across_midnight);
+    RUN_TEST(test_automatic_berlin);
+    RUN_TEST(test_automatic_polar);
+    return UNITY_END();
+}
@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include "genTimezone.h"
+#include "legacy_names.h"
+
+void setUp() { }
+
+void tearDown() { }
+
+void test_legacy_round_trip() {
+    TEST_ASSERT_EQUAL(std::size(legacyNames), timezoneLegacySize);
+    for(size_t i = 0; i < timezoneLegacySize; i++) {
+        const size_t index = timezoneFromLegacy(i);
+        TEST_ASSERT_TRUE_MESSAGE(index < timezoneSize, legacyNames[i]);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(legacyNames[i], timezoneName(index), "legacy index maps to another zone");
+    }
+    TEST_ASSERT_EQUAL(timezoneSize, timezoneFromLegacy(timezoneLegacySize));
+}
+
+void test_find_first_and_last() {
+    TEST_ASSERT_EQUAL(0, findTimezone("Africa/Abidjan"));
+    TEST_ASSERT_EQUAL(timezoneSize - 1, findTimezone("Pacific/Wallis"));
+    TEST_ASSERT_EQUAL(0, findTimezone(timezoneName(0)));
+    TEST_ASSERT_EQUAL(timezoneSize - 1, findTimezone(timezoneName(timezoneSize - 1)));
+}
+
+void test_find_unknown() {
+    TEST_ASSERT_EQUAL(timezoneSize, findTimezone("Mars/Olympus_Mons"));
+    TEST_ASSERT_EQUAL(timezoneSize, findTimezone(""));
+    TEST_ASSERT_EQUAL(timezoneSize, findTimezone("Europe/Vienn"));
+    TEST_ASSERT_EQUAL(timezoneSize, findTimezone("Europe/Vienna2"));
+    TEST_ASSERT_EQUAL(timezoneSize, findTimezone("AAA"));
+    TEST_ASSERT_EQUAL(timezoneSize, findTimezone("zzz"));
+}
+
+void test_find_every_name() {
+    // the binary search relies on the sorted table, the compile time lookup has to agree with it
+    for(size_t i = 0; i < timezoneSize; i++) {
+        if(i > 0)
+            TEST_ASSERT_TRUE_MESSAGE(strcmp(timezoneName(i - 1), timezoneName(i)) < 0, timezoneName(i));
+        TEST_ASSERT_EQUAL_MESSAGE(i, findTimezone(timezoneName(i)), timezoneName(i));
+        TEST_ASSERT_EQUAL_MESSAGE(i, timezoneIndex(timezoneName(i)), timezoneName(i));
+    }
+}
+
+int main(int, char **) {
+    UNITY_BEGIN();
+    RUN_TEST(test_legacy_round_trip);
+    RUN_TEST(test_find_first_and_last);
+    RUN_TEST(test_find_unknown);
+    RUN_TEST(test_find_every_name);
+    return UNITY_END();
+}